@@ -13,10 +13,67 @@
 
 namespace eng {
 
+  namespace {
+    const double tan30 = 0.577350269189626;
+
+    // The compliance of a frustum of a cone with a half angle of 30 degrees,
+    //   a thickness t, and a smaller outer diameter D around a hole of d
+    double frustum_compliance(const double& E, const double& d, const double& D,
+                              const double& t) {
+      return std::log(((2*t*tan30 + D - d)*(D + d))/((2*t*tan30 + D + d)*(D - d)))
+        /(pi*E*d*tan30);
+    }
+
+    // The stiffness of a stack of layers in one pass, without splitting it
+    //   into separate top and bottom stacks. The part of each layer above the
+    //   middle of the joint is a frustum growing down from the top face, and
+    //   the part below is one growing up from the bottom face. The frustums
+    //   are springs in series.
+    template<typename Thickness, typename Modulus>
+    double stack_stiffness(const std::size_t& n, const Thickness& thickness,
+                           const Modulus& modulus, const double& d, const double& dw) {
+      double total = 0;
+      for (std::size_t i = 0; i < n; ++i) {
+        total += thickness(i);
+      }
+      const double half = total/2;
+
+      double pos = 0;
+      double compliance = 0;
+      for (std::size_t i = 0; i < n; ++i) {
+        const double t = thickness(i);
+        const double top = std::min(std::max(half - pos, 0.0), t);
+        if (top > 0) {
+          compliance += frustum_compliance(modulus(i), d, dw + 2*pos*tan30, top);
+        }
+        if (t - top > 0) {
+          compliance += frustum_compliance(modulus(i), d, dw + 2*(total - pos - t)*tan30,
+                                           t - top);
+        }
+        pos += t;
+      }
+      return compliance > 0 ? 1/compliance : 0;
+    }
+  };
+
   joint_member::joint_member(const Material& mat, const Length& thi) :
     material(mat),
     thickness(thi) { }
 
+  JointArray::JointArray() :
+    offset{0} { }
+
+  void JointArray::push_back(const std::vector<joint_member>& members, const Length& d,
+                             const Length& dw) {
+    for (const auto& member : members) {
+      thickness.push_back(member.thickness.value());
+      modulus.push_back(member.material.E().Pa());
+    }
+    offset.push_back(thickness.size());
+    this->d.push_back(d.value());
+    this->dw.push_back(dw.value() > 0 ? dw.value() : 1.5*d.value());
+  }
+
   Stiffness bolt_stiffness(const Area& Ad, const Area& At, const Stress& E, 
                                     const Length& lt, const Length& ld) {
     eng::Acceleration a = 1_mpsec2;
@@ -25,32 +82,28 @@ namespace eng {
     return E*((Ad * At)/(Ad*lt + At*ld));
   }
   Stiffness members_stiffness(const std::vector<joint_member>& members, 
-                                       const Length& d, const Length& t) {
-    Stiffness ret = 0_Npm;
-    Length pos = 0_mm;
-    Length thickness = joint_thickness(members);
-
-    std::vector<joint_member> top, bottom;
-    split_members(members, top, bottom, thickness);
-
-    for (const auto& m : top) {
-      Length D = 1.5*d + 2*pos*std::tan(0.523598775598);
-      /*ret += (0.5774*pi*m.material.E()*d) /
-        std::log(((1.15*m.thickness + D - d)*(D + d))/((1.15*m.thickness + D + d)*(D - d)));*/
-      pos += m.thickness;
-    }
-    
-    pos = 0_m;
-    for (const auto& m : bottom) {
-      Length D = 1.5*d + 2*pos*std::tan(0.523598775598);
-      /*ret += (0.5774*pi*m.material.E()*d) /
-        std::log(((1.15*m.thickness + D - d)*(D + d))/((1.15*m.thickness + D + d)*(D - d)));*/
-      pos += m.thickness;
+                                       const Length& d, const Length& dw) {
+    return Stiffness(stack_stiffness(
+      members.size(),
+      [&](const std::size_t& i) { return members[i].thickness.value(); },
+      [&](const std::size_t& i) { return members[i].material.E().Pa(); },
+      d.value(), dw.value() > 0 ? dw.value() : 1.5*d.value()));
+  }
+  void members_stiffness(const JointArray& joints, std::vector<double>& stiffness) {
+    const std::size_t n = joints.size();
+    stiffness.resize(n);
+    const double* thickness = joints.thickness.data();
+    const double* modulus = joints.modulus.data();
+    for (std::size_t j = 0; j < n; ++j) {
+      const std::size_t first = joints.offset[j];
+      stiffness[j] = stack_stiffness(
+        joints.offset[j + 1] - first,
+        [&](const std::size_t& i) { return thickness[first + i]; },
+        [&](const std::size_t& i) { return modulus[first + i]; },
+        joints.d[j], joints.dw[j]);
     }
-
-    return ret;
   }
-  Length joint_thickness(const std::vector<joint_member> members) {
+  Length joint_thickness(const std::vector<joint_member>& members) {
     Length ret = 0_m;
     for (const auto& member : members) {
       ret += member.thickness;
@@ -61,14 +114,17 @@ namespace eng {
                      std::vector<joint_member>& bottom, const Length& thickness) { 
     Length pos = 0_m;
     Length half = thickness/2;
+    // A face within rounding of the middle is on it, so the sum of the
+    //   thicknesses above it never splits off a sliver of the next member
+    const Length tolerance = 1e-9*thickness;
     
     for (const auto& member : members) {
       // determine whether the current member goes in the top half of bottom 
       //    half or if it should be split into both
-      if (pos < half && pos + member.thickness < half) {
+      if (pos + member.thickness <= half + tolerance) {
         // this member goes in the top half
         top.push_back(member);
-      } else if (pos < half && pos + member.thickness > half) {
+      } else if (pos < half - tolerance) {
         // this member should be split into both halves
         top.push_back(joint_member(member.material, half - pos));
         bottom.push_back(joint_member(member.material, pos + member.thickness - half));
@@ -76,10 +132,11 @@ namespace eng {
         // this member goes in the bottom half
         bottom.push_back(member);
       }
-      std::reverse(bottom.begin(), bottom.end());
 
       pos += member.thickness;
     }
+    // the bottom members were added from the inside out
+    std::reverse(bottom.begin(), bottom.end());
     return;
   }
 
@@ -11,6 +11,7 @@
 
 // TODO: MAKE SURE THIS IS ALL CORRECT (THESE EUQATIONS ARE VERY LONG)
 
+#include <cstddef>
 #include <vector>
 #include <utility>
 
@@ -19,6 +20,7 @@
 #include "Units/Length.h"
 #include "Units/Area.h"
 #include "Units/Force.h"
+#include "Units/Stiffness.h"
 
 namespace eng {
 
@@ -29,14 +31,38 @@ namespace eng {
     joint_member(const Material& mat, const Length& thi);
   };
 
+  /**
+   * \class JointArray The member stacks of many bolted joints stored as
+   *   flat arrays in SI units, with the layers of each joint following each
+   *   other from the top of the joint to the bottom
+   */
+  struct JointArray {
+    std::vector<double> thickness;      /**< The thickness of every layer */
+    std::vector<double> modulus;        /**< Young's modulus of every layer */
+    std::vector<std::size_t> offset;    /**< The first layer of each joint, then the total */
+    std::vector<double> d;              /**< The bolt diameter of each joint */
+    std::vector<double> dw;             /**< The washer face diameter of each joint */
+
+    JointArray();
+
+    std::size_t size() const { return d.size(); }
+    /* Add a joint, where a washer face diameter of zero uses 1.5d */
+    void push_back(const std::vector<joint_member>& members, const Length& d,
+                   const Length& dw = 0_m);
+  };
+
   /* Calculate the stiffness of a bolt */
   Stiffness bolt_stiffness(const Area& Ad, const Area& At, const Stress& E, const Length& lt,
                            const Length& ld);
-  /* Calculate the stiffess of members bolted by a bolt */
+  /* Calculate the stiffess of members bolted by a bolt with the frustum
+   * model, where the pressure spreads out from the washer face of diameter
+   * dw at 30 degrees towards the middle of the joint. A dw of zero uses 1.5d. */
   Stiffness members_stiffness(const std::vector<joint_member>& members, const Length& d, 
-                              const Length& t);
+                              const Length& dw = 0_m);
+  /* Calculate the stiffness in N/m of the members of many joints */
+  void members_stiffness(const JointArray& joints, std::vector<double>& stiffness);
   /* Calculate the thickness of a bolted joint. */
-  Length joint_thickness(const std::vector<joint_member> members);
+  Length joint_thickness(const std::vector<joint_member>& members);
   /* Split the joint members into the top and bottom half 
        Both vectors will have their first elements 
        on the outside of the joint and continue inwards.*/
@@ -0,0 +1,130 @@
+#include "pch.h"
+#include "BoltGroup.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <eigen3/Eigen/Dense>
+
+namespace eng {
+
+  void BoltGroupResults::resize(const std::size_t& n) {
+    shear.resize(n);
+    tension.resize(n);
+    yield.resize(n);
+    load.resize(n);
+    separation.resize(n);
+  }
+
+  BoltGroup::BoltGroup(const std::vector<LengthVec>& positions, const Stress& Sp, const Area& At,
+                       const double& C, const Force& Fi, const double& prying) :
+    _polar(0),
+    _Sp(Sp),
+    _At(At),
+    _C(C),
+    _Fi(Fi),
+    _prying(prying) {
+    const std::size_t n = positions.size();
+    for (const auto& p : positions) {
+      _centroid += p;
+    }
+    if (n > 0) {
+      _centroid /= static_cast<double>(n);
+    }
+
+    Eigen::Matrix2d second = Eigen::Matrix2d::Zero();
+    _dx.reserve(n);
+    _dy.reserve(n);
+    for (const auto& p : positions) {
+      const double dx = (p.x() - _centroid.x()).value();
+      const double dy = (p.y() - _centroid.y()).value();
+      _dx.push_back(dx);
+      _dy.push_back(dy);
+      second += Eigen::Vector2d(dx, dy)*Eigen::RowVector2d(dx, dy);
+    }
+    _polar = second.trace();
+
+    // A pattern in a line cannot resist bending across it, so the pseudo
+    //   inverse leaves that part of the moment out
+    const Eigen::Matrix2d inverse = second.completeOrthogonalDecomposition().pseudoInverse();
+    for (int i = 0; i != 2; ++i) {
+      for (int j = 0; j != 2; ++j) {
+        _bending[i][j] = inverse(i, j);
+      }
+    }
+  }
+
+  double BoltGroup::solve(const AppliedLoad& load, const AppliedMoment& moment,
+                          BoltGroupResults& results) const {
+    return solve(std::vector<AppliedLoad>{load}, std::vector<AppliedMoment>{moment}, results);
+  }
+
+  double BoltGroup::solve(const std::vector<AppliedLoad>& loads,
+                          const std::vector<AppliedMoment>& moments,
+                          BoltGroupResults& results) const {
+    if (loads.size() != moments.size()) {
+      results.resize(0);
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+    const std::size_t cases = loads.size();
+    const std::size_t n = size();
+    results.resize(cases*n);
+
+    double minimum = HUGE_VAL;
+    for (std::size_t i = 0; i < cases; ++i) {
+      const ForceVec F = loads[i].get_force_vector().value_or(ForceVec());
+      const MomentVec M = moments[i].get_moment_vector().value_or(MomentVec());
+      // move the load to the centroid, M + r x F
+      const LengthVec r = loads[i].get_position() - _centroid;
+      const double rx = r.x().value(), ry = r.y().value(), rz = r.z().value();
+      const double f[3] = {F.x().value(), F.y().value(), F.z().value()};
+      const double m[3] = {M.x().value() + ry*f[2] - rz*f[1],
+                           M.y().value() + rz*f[0] - rx*f[2],
+                           M.z().value() + rx*f[1] - ry*f[0]};
+      minimum = std::min(minimum, solve(f, m, i*n, results));
+    }
+    return minimum;
+  }
+
+  double BoltGroup::solve(const double F[3], const double M[3], const std::size_t& first,
+                          BoltGroupResults& results) const {
+    const std::size_t n = size();
+    if (n == 0) {
+      return HUGE_VAL;
+    }
+
+    // direct shear and tension, shared equally
+    const double direct_x = F[0]/n;
+    const double direct_y = F[1]/n;
+    const double direct_z = F[2]/n;
+    // torsional shear is Mz r/J perpendicular to the offset from the centroid
+    const double torsion = _polar > 0 ? M[2]/_polar : 0;
+    // the bending tension varies as a + b dx + c dy, where sum(t dy) = Mx
+    //   and sum(t dx) = -My
+    const double b = -_bending[0][0]*M[1] + _bending[0][1]*M[0];
+    const double c = -_bending[1][0]*M[1] + _bending[1][1]*M[0];
+
+    double minimum = HUGE_VAL;
+    for (std::size_t i = 0; i < n; ++i) {
+      const std::size_t k = first + i;
+      const double vx = direct_x - torsion*_dy[i];
+      const double vy = direct_y + torsion*_dx[i];
+      const double P = _prying*(direct_z + b*_dx[i] + c*_dy[i]);
+      results.shear[k] = std::hypot(vx, vy);
+      results.tension[k] = P;
+
+      const Force load(P);
+      results.yield[k] = factor_of_safety_yield(_Sp, _At, _C, load, _Fi);
+      if (P > 0) {
+        results.load[k] = factor_of_safety_load(_Sp, _At, _C, load, _Fi);
+        results.separation[k] = factor_of_safety_separation(_Fi, load, _C);
+      } else {
+        results.load[k] = HUGE_VAL;
+        results.separation[k] = HUGE_VAL;
+      }
+      minimum = std::min({minimum, results.yield[k], results.load[k], results.separation[k]});
+    }
+    return minimum;
+  }
+
+};  // namespace eng
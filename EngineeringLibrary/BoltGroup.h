@@ -0,0 +1,119 @@
+#pragma once
+
+/*****************************************************************//**
+ * \file  BoltGroup.h
+ * \brief Distribution of eccentric shear and tension loads across a group
+ *          of bolts, and the factors of safety of each bolt
+ *
+ * \author bltan
+ * \date   October 2026
+ *********************************************************************/
+
+#include <cstddef>
+#include <vector>
+
+#include "Bolt.h"
+#include "Material.h"
+#include "StaticSystems\AppliedLoad.h"
+#include "StaticSystems\AppliedMoment.h"
+
+#include "Units/Area.h"
+#include "Units/Force.h"
+#include "Units/Length.h"
+
+namespace eng {
+
+  /**
+   * \class BoltGroupResults The loads on and factors of safety of each bolt
+   *   in a group stored as parallel arrays in SI units. For several load
+   *   cases the bolts of each case follow each other.
+   */
+  struct BoltGroupResults {
+    std::vector<double> shear;        /**< The magnitude of the shear force */
+    std::vector<double> tension;      /**< The external tension, including prying */
+    std::vector<double> yield;        /**< factor_of_safety_yield */
+    std::vector<double> load;         /**< factor_of_safety_load */
+    std::vector<double> separation;   /**< factor_of_safety_separation */
+
+    std::size_t size() const { return shear.size(); }
+    void resize(const std::size_t& n);
+  };
+
+  /**
+   * \class BoltGroup A pattern of identical preloaded bolts through a joint
+   *    whose faces lie in the xy plane, where a positive z force pulls the
+   *    members apart.
+   *
+   *    The centroid, polar moment and second moments of the pattern are found
+   *    once. Loads are moved to the centroid, then the shear is split into a
+   *    direct part shared equally and a torsional part proportional to the
+   *    distance from the centroid, and the tension into a direct part and a
+   *    part varying linearly across the pattern from the bending moments.
+   *    Bolts in compression from bending have infinite load and separation
+   *    factors of safety.
+   */
+  class BoltGroup {
+  public:
+    /**
+     * \brief BoltGroup constructor
+     *
+     * \param positions The position of each bolt
+     * \param Sp The proof strength of the bolts
+     * \param At The tensile stress area of the bolts
+     * \param C The stiffness constant of the joint, kb/(kb + km)
+     * \param Fi The preload of the bolts
+     * \param prying The factor on the external tension of each bolt from
+     *   prying of the flanges, which is 1 for rigid flanges
+     */
+    BoltGroup(const std::vector<LengthVec>& positions, const Stress& Sp, const Area& At,
+              const double& C, const Force& Fi, const double& prying = 1);
+
+    std::size_t size() const { return _dx.size(); }
+    LengthVec centroid() const { return _centroid; }
+    /* The polar moment of the pattern per unit bolt area, the sum of r^2
+     * about the centroid */
+    Area polar_moment() const { return Area(_polar); }
+
+    /**
+     * \brief Calculate the loads and factors of safety of every bolt
+     *
+     * \param load The applied load, where an unknown force counts as zero
+     * \param moment The applied moment, where an unknown moment counts as zero
+     * \param results The loads and factors of safety of each bolt
+     * \return The smallest factor of safety of any bolt
+     */
+    double solve(const AppliedLoad& load, const AppliedMoment& moment,
+                 BoltGroupResults& results) const;
+    /**
+     * \brief Calculate the loads and factors of safety of every bolt in many
+     *   load cases
+     *
+     * \param loads The applied load of each case
+     * \param moments The applied moment of each case, the same length as loads
+     * \param results The loads and factors of safety of each bolt, case by case
+     * \return The smallest factor of safety of any bolt in any case, or NaN
+     *   with the results emptied if there is not one moment per load
+     */
+    double solve(const std::vector<AppliedLoad>& loads, const std::vector<AppliedMoment>& moments,
+                 BoltGroupResults& results) const;
+
+  private:
+    /* Solve one case whose resultant at the centroid is known, into the
+     * results starting at the first bolt */
+    double solve(const double F[3], const double M[3], const std::size_t& first,
+                 BoltGroupResults& results) const;
+
+    LengthVec _centroid;
+    std::vector<double> _dx;          /**< The x offset of each bolt from the centroid */
+    std::vector<double> _dy;          /**< The y offset of each bolt from the centroid */
+    double _polar;                    /**< sum(dx^2 + dy^2) */
+    double _bending[2][2];            /**< The inverse of [[sum dx^2, sum dx dy], [sum dx dy, sum dy^2]] */
+
+    Stress _Sp;
+    Area _At;
+    double _C;
+    Force _Fi;
+    double _prying;
+  };
+
+};  // namespace eng
@@ -0,0 +1,279 @@
+#include "pch.h"
+#include "BoltReliability.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+namespace eng {
+
+  namespace {
+
+    // Bins of a ScatterHistogram: 256 per power of two of the magnitude from
+    //   2^-16 to 2^32, on each side of zero
+    const int mantissa_bits = 8;
+    const int min_exponent = 1023 - 16;
+    const int max_exponent = 1023 + 32;
+    const std::size_t magnitude_count = (max_exponent - min_exponent) << mantissa_bits;
+    const std::size_t bin_count = 2*magnitude_count;
+
+    // Samples evaluated at a time by each thread
+    const std::size_t chunk = 8192;
+
+    // The bin of the magnitude of a sample, where the first and last bins
+    //   take everything smaller and larger
+    std::size_t magnitude_bin(const std::uint64_t& bits) {
+      const int exponent = static_cast<int>((bits >> 52) & 0x7FF);
+      if (exponent < min_exponent) {
+        return 0;
+      }
+      if (exponent >= max_exponent) {
+        return magnitude_count - 1;
+      }
+      return (static_cast<std::size_t>(exponent - min_exponent) << mantissa_bits)
+        | static_cast<std::size_t>((bits >> (52 - mantissa_bits)) & ((1u << mantissa_bits) - 1));
+    }
+
+    // The lower edge of the magnitudes of a bin
+    double magnitude_edge(const std::size_t& i) {
+      const int exponent = static_cast<int>(i >> mantissa_bits) + min_exponent - 1023;
+      const double mantissa = 1 + static_cast<double>(i & ((1u << mantissa_bits) - 1))
+                                  /(1u << mantissa_bits);
+      return std::ldexp(mantissa, exponent);
+    }
+
+    // The negative bins mirror the positive ones below them, so the bins
+    //   are in increasing order of the samples they hold
+    std::size_t bin(const double& x) {
+      std::uint64_t bits;
+      std::memcpy(&bits, &x, sizeof(bits));
+      const std::size_t i = magnitude_bin(bits);
+      return std::signbit(x) ? magnitude_count - 1 - i : magnitude_count + i;
+    }
+
+    // The lower edge of a bin
+    double edge(const std::size_t& i) {
+      if (i >= magnitude_count) {
+        return i == magnitude_count ? 0 : magnitude_edge(i - magnitude_count);
+      }
+      return -magnitude_edge(magnitude_count - i);
+    }
+
+    // A counter based generator: the SplitMix64 finalizer of the seed and
+    //   counter, which passes BigCrush for sequential counters
+    std::uint64_t mix(std::uint64_t z) {
+      z = (z ^ (z >> 30))*0xBF58476D1CE4E5B9ull;
+      z = (z ^ (z >> 27))*0x94D049BB133111EBull;
+      return z ^ (z >> 31);
+    }
+
+    // A uniform number in (0, 1) from 53 random bits
+    double uniform(const std::uint64_t& seed, const std::uint64_t& counter) {
+      return ((mix(seed + counter*0x9E3779B97F4A7C15ull) >> 11) + 0.5)*0x1.0p-53;
+    }
+
+    // A standard normal number from a uniform one by Acklam's rational
+    //   approximation of the inverse normal distribution, which is good to
+    //   about 1e-9. Unlike Box-Muller it only needs a logarithm in the tails,
+    //   so most samples are a few multiplications and one division.
+    double normal(const double& p) {
+      const double low = 0.02425;
+      if (p > low && p < 1 - low) {
+        const double q = p - 0.5;
+        const double r = q*q;
+        return (((((-3.969683028665376e+01*r + 2.209460984245205e+02)*r
+                   - 2.759285104469687e+02)*r + 1.383577518672690e+02)*r
+                 - 3.066479806614716e+01)*r + 2.506628277459239e+00)*q
+          /(((((-5.447609879822406e+01*r + 1.615858368580409e+02)*r
+               - 1.556989798598866e+02)*r + 6.680131188771972e+01)*r
+             - 1.328068155288572e+01)*r + 1);
+      }
+      const double q = std::sqrt(-2*std::log(std::min(p, 1 - p)));
+      const double x = (((((-7.784894002430293e-03*q - 3.223964580411365e-01)*q
+                           - 2.400758277161838e+00)*q - 2.549732539343734e+00)*q
+                         + 4.374664141464968e+00)*q + 2.938163982698783e+00)
+        /((((7.784695709041462e-03*q + 3.224671290700398e-01)*q
+            + 2.445134137142996e+00)*q + 3.754408661907416e+00)*q + 1);
+      return p < 0.5 ? x : -x;
+    }
+
+  };  // namespace
+
+  /*
+   * ScatterHistogram
+   */
+
+  ScatterHistogram::ScatterHistogram() :
+    _bins(bin_count),
+    _count(0) { }
+
+  void ScatterHistogram::add(const double& x) {
+    ++_bins[bin(x)];
+    ++_count;
+  }
+
+  void ScatterHistogram::merge(const ScatterHistogram& other) {
+    for (std::size_t i = 0; i != bin_count; ++i) {
+      _bins[i] += other._bins[i];
+    }
+    _count += other._count;
+  }
+
+  double ScatterHistogram::percentile(const double& q) const {
+    if (_count == 0) {
+      return 0;
+    }
+    const double target = std::min(std::max(q, 0.0), 1.0)*_count;
+    double below = 0;
+    for (std::size_t i = 0; i != bin_count; ++i) {
+      if (_bins[i] > 0 && below + _bins[i] >= target) {
+        // interpolate within the bin
+        const double fraction = (target - below)/_bins[i];
+        return edge(i) + fraction*(edge(i + 1) - edge(i));
+      }
+      below += _bins[i];
+    }
+    return edge(bin_count);
+  }
+
+  /*
+   * PreloadReliability
+   */
+
+  PreloadReliability::PreloadReliability() :
+    _samples(0),
+    _reliable(0) { }
+
+  double PreloadReliability::reliability() const {
+    return _samples > 0 ? static_cast<double>(_reliable)/_samples : 0;
+  }
+
+  void PreloadReliability::merge(const PreloadReliability& other) {
+    _samples += other._samples;
+    _reliable += other._reliable;
+    _preload.merge(other._preload);
+    _yield.merge(other._yield);
+    _load.merge(other._load);
+    _separation.merge(other._separation);
+  }
+
+  /*
+   * PreloadMonteCarlo
+   */
+
+  void PreloadMonteCarlo::Batch::resize(const std::size_t& n) {
+    preload.resize(n);
+    yield.resize(n);
+    load.resize(n);
+    separation.resize(n);
+  }
+
+  PreloadMonteCarlo::PreloadMonteCarlo(const Stress& Sp, const Area& At, const double& C) :
+    _Sp_At((Sp*At).value()),
+    _C(C) { }
+
+  PreloadMonteCarlo& PreloadMonteCarlo::torque(const Torque& mean, const Torque& deviation) {
+    _torque[0] = mean.value();
+    _torque[1] = deviation.value();
+    return *this;
+  }
+
+  PreloadMonteCarlo& PreloadMonteCarlo::nut_factor(const double& mean, const double& deviation) {
+    _nut_factor[0] = mean;
+    _nut_factor[1] = deviation;
+    return *this;
+  }
+
+  PreloadMonteCarlo& PreloadMonteCarlo::diameter(const Length& mean, const Length& deviation) {
+    _diameter[0] = mean.value();
+    _diameter[1] = deviation.value();
+    return *this;
+  }
+
+  PreloadMonteCarlo& PreloadMonteCarlo::load(const Force& mean, const Force& deviation) {
+    _load[0] = mean.N();
+    _load[1] = deviation.N();
+    return *this;
+  }
+
+  PreloadMonteCarlo& PreloadMonteCarlo::require(const double& factor) {
+    _required = factor;
+    return *this;
+  }
+
+  PreloadMonteCarlo& PreloadMonteCarlo::seed(const std::uint64_t& seed) {
+    _seed = seed;
+    return *this;
+  }
+
+  void PreloadMonteCarlo::sample(const std::uint64_t& first, const std::size_t& count,
+                                 Batch& batch) const {
+    batch.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      // four independent counters per sample
+      const std::uint64_t counter = 4*(first + i);
+      const double T = _torque[0] + _torque[1]*normal(uniform(_seed, counter));
+      const double K = std::max(_nut_factor[0] + _nut_factor[1]*normal(uniform(_seed, counter + 1)),
+                                1e-3);
+      const double d = _diameter[0] + _diameter[1]*normal(uniform(_seed, counter + 2));
+      const double P = _load[0] + _load[1]*normal(uniform(_seed, counter + 3));
+
+      // the same equations as the factor_of_safety functions in Bolt.h
+      const double Fi = std::max(T/(K*d), 0.0);
+      batch.preload[i] = Fi;
+      batch.yield[i] = _Sp_At/(_C*P + Fi);
+      batch.load[i] = P > 0 ? (_Sp_At - Fi)/(_C*P) : HUGE_VAL;
+      batch.separation[i] = P > 0 ? Fi/(P*(1 - _C)) : HUGE_VAL;
+    }
+  }
+
+  void PreloadMonteCarlo::run(const std::uint64_t& first, const std::size_t& count, Batch& batch,
+                              PreloadReliability& results) const {
+    sample(first, count, batch);
+    for (std::size_t i = 0; i < count; ++i) {
+      results._preload.add(batch.preload[i]);
+      results._yield.add(batch.yield[i]);
+      results._load.add(batch.load[i]);
+      results._separation.add(batch.separation[i]);
+      results._reliable += std::min({batch.yield[i], batch.load[i], batch.separation[i]})
+        >= _required;
+    }
+    results._samples += count;
+  }
+
+  PreloadReliability PreloadMonteCarlo::run(const std::uint64_t& samples,
+                                            const unsigned& threads) const {
+    const std::uint64_t chunks = (samples + chunk - 1)/chunk;
+    unsigned workers = threads > 0 ? threads : std::max(1u, std::thread::hardware_concurrency());
+    workers = static_cast<unsigned>(std::min<std::uint64_t>(workers, std::max<std::uint64_t>(chunks, 1)));
+
+    // Each worker keeps its own statistics, which are merged at the end
+    std::vector<PreloadReliability> partial(workers);
+    std::atomic<std::uint64_t> next(0);
+    auto work = [&](PreloadReliability& results) {
+      Batch batch;
+      for (std::uint64_t i = next++; i < chunks; i = next++) {
+        const std::uint64_t first = i*chunk;
+        run(first, static_cast<std::size_t>(std::min<std::uint64_t>(chunk, samples - first)),
+            batch, results);
+      }
+    };
+    std::vector<std::thread> pool;
+    pool.reserve(workers - 1);
+    for (unsigned i = 1; i < workers; ++i) {
+      pool.emplace_back(work, std::ref(partial[i]));
+    }
+    work(partial[0]);
+    for (auto& thread : pool) {
+      thread.join();
+    }
+
+    for (unsigned i = 1; i < workers; ++i) {
+      partial[0].merge(partial[i]);
+    }
+    return partial[0];
+  }
+
+};  // namespace eng
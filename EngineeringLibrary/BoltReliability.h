@@ -0,0 +1,156 @@
+#pragma once
+
+/*****************************************************************//**
+ * \file  BoltReliability.h
+ * \brief Monte Carlo simulation of the scatter in the preload of torqued
+ *          bolts, and the reliability of the joint it gives
+ *
+ * \author bltan
+ * \date   October 2026
+ *********************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Bolt.h"
+#include "Material.h"
+
+#include "Units/Area.h"
+#include "Units/Force.h"
+#include "Units/Length.h"
+#include "Units/Torque.h"
+
+namespace eng {
+
+  /**
+   * \class ScatterHistogram Counts of samples in bins which are evenly spaced
+   *    within each power of two, so each bin is under 0.4% wide for
+   *    magnitudes from 2^-16 to 2^32. Negative samples, such as the load
+   *    factor of safety of a bolt preloaded past its proof load, have bins
+   *    mirroring the positive ones. A sample finds its bin from the bits of
+   *    its sign, exponent and mantissa, and histograms from separate threads
+   *    add together exactly.
+   */
+  class ScatterHistogram {
+  public:
+    ScatterHistogram();
+
+    void add(const double& x);
+    void merge(const ScatterHistogram& other);
+
+    std::uint64_t count() const { return _count; }
+    /* The value below which a fraction q of the samples lie */
+    double percentile(const double& q) const;
+
+  private:
+    std::vector<std::uint64_t> _bins;
+    std::uint64_t _count;
+  };
+
+  /**
+   * \class PreloadReliability The results of a PreloadMonteCarlo: how often
+   *    the joint met the required factors of safety, and the spread of the
+   *    preload and factors of safety
+   */
+  class PreloadReliability {
+  public:
+    PreloadReliability();
+
+    std::uint64_t samples() const { return _samples; }
+    /* The fraction of samples where every factor of safety met the requirement */
+    double reliability() const;
+
+    /* The preload below which a fraction q of the samples lie */
+    Force preload(const double& q) const { return Force(_preload.percentile(q)); }
+    /* The factor of safety below which a fraction q of the samples lie */
+    double yield(const double& q) const { return _yield.percentile(q); }
+    double load(const double& q) const { return _load.percentile(q); }
+    double separation(const double& q) const { return _separation.percentile(q); }
+
+    void merge(const PreloadReliability& other);
+
+  private:
+    friend class PreloadMonteCarlo;
+
+    std::uint64_t _samples;
+    std::uint64_t _reliable;
+    ScatterHistogram _preload;
+    ScatterHistogram _yield;
+    ScatterHistogram _load;
+    ScatterHistogram _separation;
+  };
+
+  /**
+   * \class PreloadMonteCarlo Samples the tightening torque, nut factor, bolt
+   *    diameter and external load of a joint from normal distributions, finds
+   *    the preload from T = K Fi d, and evaluates factor_of_safety_yield,
+   *    factor_of_safety_load and factor_of_safety_separation for each sample.
+   *
+   *    The random numbers of sample i are a hash of the seed and i, so a run
+   *    gives the same results on any number of threads, and any range of
+   *    samples can be reproduced on its own.
+   */
+  class PreloadMonteCarlo {
+  public:
+    /** The samples of a range as parallel arrays in SI units */
+    struct Batch {
+      std::vector<double> preload;
+      std::vector<double> yield;
+      std::vector<double> load;
+      std::vector<double> separation;
+
+      std::size_t size() const { return preload.size(); }
+      void resize(const std::size_t& n);
+    };
+
+    /**
+     * \brief PreloadMonteCarlo constructor
+     *
+     * \param Sp The proof strength of the bolt
+     * \param At The tensile stress area of the bolt
+     * \param C The stiffness constant of the joint, kb/(kb + km)
+     */
+    PreloadMonteCarlo(const Stress& Sp, const Area& At, const double& C);
+
+    /** Set the mean and standard deviation of the tightening torque */
+    PreloadMonteCarlo& torque(const Torque& mean, const Torque& deviation);
+    /** Set the mean and standard deviation of the nut factor, 0.2 and 0.03
+     *    by default */
+    PreloadMonteCarlo& nut_factor(const double& mean, const double& deviation);
+    /** Set the mean and standard deviation of the bolt diameter */
+    PreloadMonteCarlo& diameter(const Length& mean, const Length& deviation);
+    /** Set the mean and standard deviation of the external tension on the bolt */
+    PreloadMonteCarlo& load(const Force& mean, const Force& deviation);
+    /** Require a minimum factor of safety of every kind, 1 by default */
+    PreloadMonteCarlo& require(const double& factor);
+    PreloadMonteCarlo& seed(const std::uint64_t& seed);
+
+    /* Evaluate the samples [first, first + count) into a batch */
+    void sample(const std::uint64_t& first, const std::size_t& count, Batch& batch) const;
+
+    /**
+     * \brief Evaluate many samples and collect their statistics
+     *
+     * \param samples The number of samples
+     * \param threads The number of worker threads, where 0 uses one per
+     *   hardware thread
+     * \return The reliability and spread of the samples
+     */
+    PreloadReliability run(const std::uint64_t& samples, const unsigned& threads = 0) const;
+
+  private:
+    void run(const std::uint64_t& first, const std::size_t& count, Batch& batch,
+             PreloadReliability& results) const;
+
+    double _Sp_At;
+    double _C;
+    double _torque[2] = {0, 0};
+    double _nut_factor[2] = {0.2, 0.03};
+    double _diameter[2] = {0, 0};
+    double _load[2] = {0, 0};
+    double _required = 1;
+    std::uint64_t _seed = 0;
+  };
+
+};  // namespace eng
@@ -0,0 +1,130 @@
+#include "pch.h"
+#include "Constitutive.h"
+
+namespace eng {
+
+  namespace {
+
+    Matrix6d orthotropic_compliance(const double& Ex, const double& Ey, const double& Ez,
+                                    const double& nu_xy, const double& nu_xz,
+                                    const double& nu_yz, const double& Gxy,
+                                    const double& Gxz, const double& Gyz) {
+      Matrix6d S = Matrix6d::Zero();
+      S(0, 0) = 1/Ex;
+      S(1, 1) = 1/Ey;
+      S(2, 2) = 1/Ez;
+      S(0, 1) = S(1, 0) = -nu_xy/Ex;
+      S(0, 2) = S(2, 0) = -nu_xz/Ex;
+      S(1, 2) = S(2, 1) = -nu_yz/Ey;
+      S(3, 3) = 1/Gxy;
+      S(4, 4) = 1/Gxz;
+      S(5, 5) = 1/Gyz;
+      return S;
+    }
+
+    // Multiply every column of six parallel arrays by a 6x6 matrix. The
+    //   matrix is copied out of Eigen so the loop body only touches locals
+    //   and the arrays, which lets the compiler vectorize across elements.
+    void multiply(const Matrix6d& matrix, const double* const in[6], double* const out[6],
+                  const std::size_t& n) {
+      double m[6][6];
+      for (int r = 0; r != 6; ++r) {
+        for (int c = 0; c != 6; ++c) {
+          m[r][c] = matrix(r, c);
+        }
+      }
+      const double* x0 = in[0];
+      const double* x1 = in[1];
+      const double* x2 = in[2];
+      const double* x3 = in[3];
+      const double* x4 = in[4];
+      const double* x5 = in[5];
+      for (int r = 0; r != 6; ++r) {
+        const double m0 = m[r][0], m1 = m[r][1], m2 = m[r][2];
+        const double m3 = m[r][3], m4 = m[r][4], m5 = m[r][5];
+        double* y = out[r];
+        for (std::size_t i = 0; i < n; ++i) {
+          y[i] = m0*x0[i] + m1*x1[i] + m2*x2[i] + m3*x3[i] + m4*x4[i] + m5*x5[i];
+        }
+      }
+    }
+
+  };  // namespace
+
+  LinearElastic::LinearElastic(const MaterialBase& material) {
+    const double E = material.E().Pa();
+    const double G = material.G().Pa();
+    const double nu = material.nu();
+    _compliance = orthotropic_compliance(E, E, E, nu, nu, nu, G, G, G);
+    _stiffness = _compliance.inverse();
+  }
+
+  LinearElastic::LinearElastic(const Stress& Ep, const Stress& Et, const double& nu_p,
+                               const double& nu_pt, const Stress& Gt) {
+    const double Gp = Ep.Pa()/(2*(1 + nu_p));
+    _compliance = orthotropic_compliance(Ep.Pa(), Ep.Pa(), Et.Pa(), nu_p, nu_pt, nu_pt,
+                                         Gp, Gt.Pa(), Gt.Pa());
+    _stiffness = _compliance.inverse();
+  }
+
+  LinearElastic::LinearElastic(const Stress& Ex, const Stress& Ey, const Stress& Ez,
+                               const double& nu_xy, const double& nu_xz, const double& nu_yz,
+                               const Stress& Gxy, const Stress& Gxz, const Stress& Gyz) {
+    _compliance = orthotropic_compliance(Ex.Pa(), Ey.Pa(), Ez.Pa(), nu_xy, nu_xz, nu_yz,
+                                         Gxy.Pa(), Gxz.Pa(), Gyz.Pa());
+    _stiffness = _compliance.inverse();
+  }
+
+  LinearElastic::LinearElastic(const Matrix6d& stiffness) :
+    _stiffness(stiffness),
+    _compliance(stiffness.inverse()) { }
+
+  bool LinearElastic::admissible() const {
+    return _stiffness.allFinite() && _stiffness.llt().info() == Eigen::Success;
+  }
+
+  void LinearElastic::strain(const StressElement3& stress, NormalStrain& normal,
+                             ShearStrain& shear) const {
+    Eigen::Matrix<double, 6, 1> s;
+    s << stress.sigma_x.Pa(), stress.sigma_y.Pa(), stress.sigma_z.Pa(),
+         stress.tau_xy.Pa(), stress.tau_xz.Pa(), stress.tau_yz.Pa();
+    const Eigen::Matrix<double, 6, 1> e = _compliance*s;
+    normal = NormalStrain(e(0), e(1), e(2));
+    shear = ShearStrain(Angle(e(3)), Angle(e(4)), Angle(e(5)));
+  }
+
+  StressElement3 LinearElastic::stress(const NormalStrain& normal,
+                                       const ShearStrain& shear) const {
+    Eigen::Matrix<double, 6, 1> e;
+    e << normal.epsilon_x, normal.epsilon_y, normal.epsilon_z,
+         shear.gamma_xy.rad(), shear.gamma_xz.rad(), shear.gamma_yz.rad();
+    const Eigen::Matrix<double, 6, 1> s = _stiffness*e;
+    return StressElement3(Stress(s(0)), Stress(s(1)), Stress(s(2)),
+                          Stress(s(3)), Stress(s(4)), Stress(s(5)));
+  }
+
+  void LinearElastic::strain(const StressElement3Array& stress,
+                             StrainElement3Array& strain) const {
+    strain.resize(stress.size());
+    const double* const in[6] = {stress.sigma_x.data(), stress.sigma_y.data(),
+                                 stress.sigma_z.data(), stress.tau_xy.data(),
+                                 stress.tau_xz.data(), stress.tau_yz.data()};
+    double* const out[6] = {strain.epsilon_x.data(), strain.epsilon_y.data(),
+                            strain.epsilon_z.data(), strain.gamma_xy.data(),
+                            strain.gamma_xz.data(), strain.gamma_yz.data()};
+    multiply(_compliance, in, out, stress.size());
+  }
+
+  void LinearElastic::stress(const StrainElement3Array& strain,
+                             StressElement3Array& stress) const {
+    stress.resize(strain.size());
+    const double* const in[6] = {strain.epsilon_x.data(), strain.epsilon_y.data(),
+                                 strain.epsilon_z.data(), strain.gamma_xy.data(),
+                                 strain.gamma_xz.data(), strain.gamma_yz.data()};
+    double* const out[6] = {stress.sigma_x.data(), stress.sigma_y.data(),
+                            stress.sigma_z.data(), stress.tau_xy.data(),
+                            stress.tau_xz.data(), stress.tau_yz.data()};
+    multiply(_stiffness, in, out, strain.size());
+  }
+
+};  // namespace eng
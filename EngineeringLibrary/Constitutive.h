@@ -0,0 +1,93 @@
+#pragma once
+
+/*****************************************************************//**
+ * \file  Constitutive.h
+ * \brief Generalized Hooke's law with the full stiffness and compliance
+ *          matrices of isotropic, transversely isotropic and orthotropic
+ *          materials
+ *
+ * \author bltan
+ * \date   October 2026
+ *********************************************************************/
+
+#include <eigen3/Eigen/Dense>
+
+#include "Material.h"
+#include "Strain.h"
+#include "Stress.h"
+
+namespace eng {
+
+  using Matrix6d = Eigen::Matrix<double, 6, 6>;
+
+  /**
+   * \class LinearElastic The 6x6 stiffness and compliance matrices of a
+   *    linear elastic material, computed once when it is constructed.
+   *
+   *    Stresses and strains are ordered x, y, z, xy, xz, yz as in
+   *    StressElement3, and the shear strains are engineering shear strains.
+   */
+  class LinearElastic {
+  public:
+    /**
+     * \brief LinearElastic constructor for an isotropic material
+     *
+     * \param material The material
+     */
+    LinearElastic(const MaterialBase& material);
+    /**
+     * \brief LinearElastic constructor for a transversely isotropic material,
+     *   which is isotropic in the xy plane
+     *
+     * \param Ep Young's modulus in the xy plane
+     * \param Et Young's modulus along the z axis
+     * \param nu_p Poisson's ratio in the xy plane
+     * \param nu_pt Poisson's ratio of the strain along z from a stress in
+     *   the xy plane
+     * \param Gt The modulus of rigidity of the xz and yz planes
+     */
+    LinearElastic(const Stress& Ep, const Stress& Et, const double& nu_p, const double& nu_pt,
+                  const Stress& Gt);
+    /**
+     * \brief LinearElastic constructor for an orthotropic material with its
+     *   axes of symmetry along x, y and z
+     *
+     * \param Ex, Ey, Ez Young's modulus along each axis
+     * \param nu_xy, nu_xz, nu_yz Poisson's ratio of the strain along the
+     *   second axis from a stress along the first
+     * \param Gxy, Gxz, Gyz The modulus of rigidity of each plane
+     */
+    LinearElastic(const Stress& Ex, const Stress& Ey, const Stress& Ez,
+                  const double& nu_xy, const double& nu_xz, const double& nu_yz,
+                  const Stress& Gxy, const Stress& Gxz, const Stress& Gyz);
+    /**
+     * \brief LinearElastic constructor from a stiffness matrix in Pa, such as
+     *   the stiffness of a material rotated to the axes of a layup
+     *
+     * \param stiffness The symmetric stiffness matrix
+     */
+    LinearElastic(const Matrix6d& stiffness);
+
+    const Matrix6d& stiffness() const { return _stiffness; }
+    const Matrix6d& compliance() const { return _compliance; }
+
+    /* If the stiffness is positive definite, so that every strain stores
+     * energy. Materials with impossible constants are not. */
+    bool admissible() const;
+
+    /* Calculate the strains caused by a stress state */
+    void strain(const StressElement3& stress, NormalStrain& normal, ShearStrain& shear) const;
+    /* Calculate the stress state which causes a set of strains */
+    StressElement3 stress(const NormalStrain& normal, const ShearStrain& shear) const;
+
+    /* Calculate the strains caused by many stress states */
+    void strain(const StressElement3Array& stress, StrainElement3Array& strain) const;
+    /* Calculate the stress states which cause many sets of strains */
+    void stress(const StrainElement3Array& strain, StressElement3Array& stress) const;
+
+  private:
+    Matrix6d _stiffness;
+    Matrix6d _compliance;
+  };
+
+};  // namespace eng
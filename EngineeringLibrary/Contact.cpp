@@ -0,0 +1,202 @@
+#include "pch.h"
+#include "Contact.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace eng {
+
+  namespace {
+
+    // Coefficients of the largest shear stress below the surface
+    const double point_shear = 0.31;
+    const double line_shear = 0.30;
+
+    double curvature(const Length& R) {
+      return R.value() != 0 ? 1/R.value() : 0;
+    }
+
+    // The complete elliptic integrals K and E of the ellipse with a ratio k
+    //   of minor to major axes, by the arithmetic-geometric mean
+    void elliptic_integrals(const double& k, double& K, double& E) {
+      double a = 1;
+      double b = k;
+      double sum = (1 - k*k)/2;
+      double power = 0.5;
+      for (int i = 0; i != 32 && a - b > 1e-16*a; ++i) {
+        const double c = (a - b)/2;
+        const double next = (a + b)/2;
+        b = std::sqrt(a*b);
+        a = next;
+        power *= 2;
+        sum += power*c*c;
+      }
+      K = pi/(2*a);
+      E = K*(1 - sum);
+    }
+
+    // The ratio of curvatures B/A of the contact ellipse with a ratio k of
+    //   minor to major semi-axes
+    double curvature_ratio(const double& k) {
+      double K, E;
+      elliptic_integrals(k, K, E);
+      return (E/(k*k) - K)/(K - E);
+    }
+
+    /**
+     * The shape of the contact ellipse at evenly spaced values of ln(B/A).
+     *   ln(k) is close to linear in ln(B/A), so it is what is interpolated.
+     */
+    class EllipseTable {
+    public:
+      static const std::size_t points = 1024;
+
+      EllipseTable() {
+        _step = std::log(max_ratio)/(points - 1);
+        _log_k[0] = 0;
+        _E[0] = _K[0] = pi/2;
+        for (std::size_t i = 1; i != points; ++i) {
+          // the ratio falls as k rises, which bisection on ln(k) follows
+          const double ratio = std::exp(_step*i);
+          double low = std::log(1e-6);
+          double high = 0;
+          for (int j = 0; j != 60; ++j) {
+            const double middle = (low + high)/2;
+            (curvature_ratio(std::exp(middle)) > ratio ? low : high) = middle;
+          }
+          _log_k[i] = (low + high)/2;
+          elliptic_integrals(std::exp(_log_k[i]), _K[i], _E[i]);
+        }
+      }
+
+      void shape(const double& ratio, double& k, double& E, double& K) const {
+        const double x = std::min(std::max(std::log(ratio)/_step, 0.0),
+                                  static_cast<double>(points - 1));
+        const std::size_t i = std::min(static_cast<std::size_t>(x), points - 2);
+        const double t = x - i;
+        k = std::exp(_log_k[i] + t*(_log_k[i + 1] - _log_k[i]));
+        E = _E[i] + t*(_E[i + 1] - _E[i]);
+        K = _K[i] + t*(_K[i + 1] - _K[i]);
+      }
+
+    private:
+      // The most elongated contact in the table, beyond which line contact
+      //   is the better model
+      static constexpr double max_ratio = 1e5;
+
+      double _step;
+      std::array<double, points> _log_k;
+      std::array<double, points> _E;
+      std::array<double, points> _K;
+    };
+
+    const EllipseTable& ellipse_table() {
+      static const EllipseTable table;
+      return table;
+    }
+
+  };  // namespace
+
+  /*
+   * ContactGeometry
+   */
+
+  std::optional<ContactGeometry> ContactGeometry::spheres(const Length& R1, const Length& R2) {
+    return bodies(R1, R1, R2, R2);
+  }
+
+  std::optional<ContactGeometry> ContactGeometry::bodies(const Length& R1x, const Length& R1y,
+                                                         const Length& R2x, const Length& R2y,
+                                                         const Angle& phi) {
+    const double k1 = curvature(R1x) - curvature(R1y);
+    const double k2 = curvature(R2x) - curvature(R2y);
+    const double sum = (curvature(R1x) + curvature(R1y) + curvature(R2x) + curvature(R2y))/2;
+    const double difference = std::sqrt(std::max(k1*k1 + k2*k2 + 2*k1*k2*std::cos(2*phi.rad()),
+                                                 0.0))/2;
+    const double A = (sum - difference)/2;
+    const double B = (sum + difference)/2;
+    if (!(B > 0) || A < 0) {
+      return std::nullopt;
+    }
+    return ContactGeometry(A, B);
+  }
+
+  ContactGeometry::ContactGeometry(const double& A, const double& B) :
+    _A(A),
+    _B(B) {
+    if (_A > 0) {
+      ellipse_table().shape(_B/_A, _k, _E, _K);
+    } else {
+      // a line contact, which the ellipse only approaches
+      ellipse_table().shape(HUGE_VAL, _k, _E, _K);
+    }
+  }
+
+  void ContactArray::resize(const std::size_t& n) {
+    a.resize(n);
+    b.resize(n);
+    max_pressure.resize(n);
+    max_shear.resize(n);
+    approach.resize(n);
+  }
+
+  /*
+   * HertzContact
+   */
+
+  HertzContact::HertzContact(const MaterialBase& first, const MaterialBase& second) :
+    _modulus(1/((1 - first.nu()*first.nu())/first.E().Pa()
+                + (1 - second.nu()*second.nu())/second.E().Pa())) { }
+
+  ContactResult HertzContact::point(const ContactGeometry& geometry, const Force& F) const {
+    const double minor = std::cbrt(3*geometry._k*geometry._E*F.N()
+                                   /(2*pi*_modulus*(geometry._A + geometry._B)));
+    const double pressure = 3*geometry._k*F.N()/(2*pi*minor*minor);
+    return ContactResult{Length(minor/geometry._k), Length(minor), Pressure(pressure),
+                         Stress(point_shear*pressure),
+                         Length(pressure*minor*geometry._K/_modulus)};
+  }
+
+  ContactResult HertzContact::line(const Length& R1, const Length& R2, const Length& L,
+                                   const Force& F) const {
+    const double R = 1/(curvature(R1) + curvature(R2));
+    const double b = std::sqrt(4*F.N()*R/(pi*L.value()*_modulus));
+    const double p0 = 2*F.N()/(pi*b*L.value());
+    return ContactResult{L/2, Length(b), Pressure(p0), Stress(line_shear*p0), std::nullopt};
+  }
+
+  void HertzContact::point(const std::vector<ContactGeometry>& geometries,
+                           const std::vector<Force>& F, ContactArray& results) const {
+    const std::size_t loads = F.size();
+    results.resize(geometries.size()*loads);
+
+    double* a = results.a.data();
+    double* b = results.b.data();
+    double* p = results.max_pressure.data();
+    double* shear = results.max_shear.data();
+    double* approach = results.approach.data();
+    for (const auto& g : geometries) {
+      // Everything but the size of the ellipse depends only on the geometry:
+      //   b^3 = 3 k E F/(2 pi E* (A + B)), p0 = 3F/(2 pi a b), delta = p0 b K/E*
+      const double size = 3*g._k*g._E/(2*pi*_modulus*(g._A + g._B));
+      const double spread = 3*g._k/(2*pi);
+      const double depth = g._K/_modulus;
+      for (std::size_t i = 0; i < loads; ++i) {
+        const double minor = std::cbrt(size*F[i].N());
+        const double pressure = spread*F[i].N()/(minor*minor);
+        a[i] = minor/g._k;
+        b[i] = minor;
+        p[i] = pressure;
+        shear[i] = point_shear*pressure;
+        approach[i] = pressure*minor*depth;
+      }
+      a += loads;
+      b += loads;
+      p += loads;
+      shear += loads;
+      approach += loads;
+    }
+  }
+
+};  // namespace eng
@@ -0,0 +1,153 @@
+#pragma once
+
+/*****************************************************************//**
+ * \file  Contact.h
+ * \brief Hertzian contact stresses and deflections between elastic bodies
+ *          with point, elliptical and line contact
+ *
+ * \author bltan
+ * \date   October 2026
+ *********************************************************************/
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "Material.h"
+#include "Stress.h"
+
+#include "Units/Angle.h"
+#include "Units/Force.h"
+#include "Units/Length.h"
+
+namespace eng {
+
+  /**
+   * \class ContactGeometry The principal radii of curvature of two bodies
+   *    where they touch, and the shape of the contact ellipse which only
+   *    depends on them.
+   *
+   *    Radii are positive for convex surfaces and negative for concave ones,
+   *    such as a bearing race groove. A radius of zero is a flat surface.
+   */
+  class ContactGeometry {
+  public:
+    /**
+     * \brief Create the geometry of two spheres
+     *
+     * \param R1 The radius of the first sphere
+     * \param R2 The radius of the second sphere
+     * \return The geometry, or nothing if the surfaces have no curvature to
+     *   concentrate the contact, such as a flat on a flat
+     */
+    static std::optional<ContactGeometry> spheres(const Length& R1, const Length& R2);
+    /**
+     * \brief Create the geometry of two bodies with any curvature
+     *
+     * \param R1x, R1y The principal radii of the first body
+     * \param R2x, R2y The principal radii of the second body
+     * \param phi The angle between the x planes of the two bodies
+     * \return The geometry, or nothing if both relative curvatures are not
+     *   positive, such as a flat on a flat or a ball in a tighter groove
+     */
+    static std::optional<ContactGeometry> bodies(const Length& R1x, const Length& R1y,
+                                                 const Length& R2x, const Length& R2y,
+                                                 const Angle& phi = 0_rad);
+
+    /* The smaller and larger relative curvatures, in 1/m */
+    double A() const { return _A; }
+    double B() const { return _B; }
+    /* The ratio of the minor to major semi-axis of the contact ellipse */
+    double ellipticity() const { return _k; }
+
+  private:
+    friend class HertzContact;
+
+    ContactGeometry(const double& A, const double& B);
+
+    double _A;
+    double _B;
+    double _k;
+    double _E;      /**< The complete elliptic integral of the second kind */
+    double _K;      /**< The complete elliptic integral of the first kind */
+  };
+
+  /**
+   * \class ContactResult The size of the contact area, the stresses in it,
+   *    and how far the bodies approach each other
+   */
+  struct ContactResult {
+    Length a;                         /**< The major semi-axis, or half the length of a line contact */
+    Length b;                         /**< The minor semi-axis, or the half-width of a line contact */
+    Pressure max_pressure;
+    Stress max_shear;                 /**< The largest shear stress below the surface */
+    std::optional<Length> approach;   /**< Unknown for line contact, where it depends on the size of the bodies */
+  };
+
+  /**
+   * \class ContactArray The results of many contacts stored as parallel
+   *   arrays in SI units
+   */
+  struct ContactArray {
+    std::vector<double> a;
+    std::vector<double> b;
+    std::vector<double> max_pressure;
+    std::vector<double> max_shear;
+    std::vector<double> approach;
+
+    std::size_t size() const { return a.size(); }
+    void resize(const std::size_t& n);
+  };
+
+  /**
+   * \class HertzContact Contact between two elastic bodies of given
+   *    materials, where the shape of an elliptical contact comes from a
+   *    table of the elliptic integrals built once for the whole program
+   *    instead of being solved for on every call.
+   *
+   *    The largest shear stress below the surface is 0.31 of the maximum
+   *    pressure for point and elliptical contact, and 0.30 for line contact,
+   *    which hold for Poisson's ratios near 0.3.
+   */
+  class HertzContact {
+  public:
+    /**
+     * \brief HertzContact constructor
+     *
+     * \param first The material of the first body
+     * \param second The material of the second body
+     */
+    HertzContact(const MaterialBase& first, const MaterialBase& second);
+
+    /* The effective modulus of the contact, where
+     * 1/E* = (1 - nu1^2)/E1 + (1 - nu2^2)/E2 */
+    Stress modulus() const { return Stress(_modulus); }
+
+    /* Calculate the contact between two bodies pressed together by a force */
+    ContactResult point(const ContactGeometry& geometry, const Force& F) const;
+    /**
+     * \brief Calculate the contact between two parallel cylinders
+     *
+     * \param R1 The radius of the first cylinder
+     * \param R2 The radius of the second cylinder, or zero for a flat
+     * \param L The length of the contact
+     * \param F The force pressing the cylinders together
+     */
+    ContactResult line(const Length& R1, const Length& R2, const Length& L, const Force& F) const;
+
+    /**
+     * \brief Calculate the contacts of every geometry under every force
+     *
+     * \param geometries The geometries of the contacts
+     * \param F The forces pressing the bodies together
+     * \param results The results of each force on the first geometry, then
+     *   of each force on the second geometry, and so on
+     */
+    void point(const std::vector<ContactGeometry>& geometries, const std::vector<Force>& F,
+               ContactArray& results) const;
+
+  private:
+    double _modulus;
+  };
+
+};  // namespace eng
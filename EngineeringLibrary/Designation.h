@@ -0,0 +1,60 @@
+#pragma once
+
+/*****************************************************************//**
+ * \file  Designation.h
+ * \brief Hashing and comparison of catalog designations, shared by the
+ *          material, fastener and section catalogs. Not part of the
+ *          public interface of the library.
+ *
+ * \author bltan
+ * \date   October 2026
+ *********************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace eng {
+
+  namespace designation {
+
+    /* Designations are hashed and compared without letter case or spaces, so
+     *   "1018 cd", "1018CD" and "1018 CD" are the same material */
+    constexpr char fold(const char& c) {
+      return (c >= 'a' && c <= 'z') ? static_cast<char>(c - 'a' + 'A') : c;
+    }
+
+    /* The FNV-1a hash of the folded designation */
+    constexpr std::uint32_t hash(std::string_view s) {
+      std::uint32_t h = 2166136261u;
+      for (char c : s) {
+        if (c != ' ') {
+          h = (h ^ static_cast<unsigned char>(fold(c))) * 16777619u;
+        }
+      }
+      return h;
+    }
+
+    /* Orders designations as their folded characters, returning -1, 0 or 1 */
+    constexpr int compare(std::string_view lh, std::string_view rh) {
+      std::size_t i = 0, j = 0;
+      while (true) {
+        while (i != lh.size() && lh[i] == ' ') ++i;
+        while (j != rh.size() && rh[j] == ' ') ++j;
+        if (i == lh.size() || j == rh.size()) {
+          return (i != lh.size()) - (j != rh.size());
+        }
+        const char l = fold(lh[i++]), r = fold(rh[j++]);
+        if (l != r) {
+          return l < r ? -1 : 1;
+        }
+      }
+    }
+
+    constexpr bool same(std::string_view lh, std::string_view rh) {
+      return compare(lh, rh) == 0;
+    }
+
+  };  // namespace designation
+
+};  // namespace eng
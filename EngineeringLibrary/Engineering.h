@@ -8,19 +8,34 @@
 
 // Include Materials
 #include "Material.h"
+#include "MaterialLibrary.h"
+#include "MaterialRegistry.h"
 #include "Stress.h"
+#include "StressTransformation.h"
+#include "ThickWalledCylinder.h"
+#include "FailureCriteria.h"
+#include "Fatigue.h"
+#include "Constitutive.h"
+#include "Rosette.h"
+#include "Thermal.h"
+#include "Plasticity.h"
+#include "Contact.h"
 
 // Include Geometry
 #include "Geometric.h"
 
 // Include Bolt calculations
 #include "Bolt.h"
+#include "BoltGroup.h"
+#include "Fastener.h"
+#include "BoltReliability.h"
 
 // Include Static Systems Analysis
 #include "Statics.h"
 
 // Include Dynamic System analysis
 #include "SystemDynamics.h"
+#include "ModalAnalysis.h"
 
 /* TODO Units:
  */
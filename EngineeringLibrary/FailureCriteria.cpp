@@ -0,0 +1,304 @@
+#include "pch.h"
+#include "FailureCriteria.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace eng {
+
+  namespace {
+    /* The criteria on plain doubles in Pa, which the single and batch
+     *   versions share. Only selects are used, so the batch loops have no
+     *   branches. */
+
+    inline double von_mises2(const double& sx, const double& sy, const double& txy) {
+      return std::sqrt(sx*sx - sx*sy + sy*sy + 3*txy*txy);
+    }
+
+    inline double von_mises3(const double& sx, const double& sy, const double& sz,
+                             const double& txy, const double& txz, const double& tyz) {
+      return std::sqrt(((sx - sy)*(sx - sy) + (sy - sz)*(sy - sz) + (sz - sx)*(sz - sx)
+                        + 6*(txy*txy + txz*txz + tyz*tyz))/2);
+    }
+
+    /* The in plane principal stresses, with the out of plane principal
+     *   stress of zero included in the largest and smallest */
+    inline void extreme_principal2(const double& sx, const double& sy, const double& txy,
+                                   double& s1, double& s3) {
+      const double center = (sx + sy)/2;
+      const double radius = std::sqrt((sx - sy)*(sx - sy)/4 + txy*txy);
+      s1 = std::max(center + radius, 0.0);
+      s3 = std::min(center - radius, 0.0);
+    }
+
+    inline double mohr_coulomb(const double& s1, const double& s3,
+                               const double& St, const double& Sc) {
+      return 1/(std::max(s1, 0.0)/St - std::min(s3, 0.0)/Sc);
+    }
+
+    inline double goodman(const double& alternating, const double& mean,
+                          const double& Se, const double& Sut) {
+      return 1/(alternating/Se + mean/Sut);
+    }
+
+    /* Fill n with strength/equivalent and return the smallest */
+    double factors_of_safety(const std::vector<double>& equivalent, const double& strength,
+                             std::vector<double>& n) {
+      const std::size_t count = equivalent.size();
+      n.resize(count);
+      double least = std::numeric_limits<double>::infinity();
+      for (std::size_t i = 0; i < count; ++i) {
+        n[i] = strength/equivalent[i];
+        least = std::min(least, n[i]);
+      }
+      return least;
+    }
+
+    /* Fill n with the yield strength of each element's material over its
+     *   equivalent stress and return the smallest */
+    double factors_of_safety(const std::vector<double>& equivalent,
+                             const MaterialPropertyArray& materials,
+                             const std::vector<MaterialHandle>& handles,
+                             std::vector<double>& n) {
+      const std::size_t count = equivalent.size();
+      if (!materials.contains(handles, count)) {
+        n.clear();
+        return std::numeric_limits<double>::quiet_NaN();
+      }
+      n.resize(count);
+      const double* Sy = materials.Sy.data();
+      double least = std::numeric_limits<double>::infinity();
+      for (std::size_t i = 0; i < count; ++i) {
+        n[i] = Sy[handles[i]]/equivalent[i];
+        least = std::min(least, n[i]);
+      }
+      return least;
+    }
+  };
+
+  Stress von_mises(const StressElement2& s) {
+    return Stress(von_mises2(s.sigma_x.Pa(), s.sigma_y.Pa(), s.tau_xy.Pa()));
+  }
+
+  Stress von_mises(const StressElement3& s) {
+    return Stress(von_mises3(s.sigma_x.Pa(), s.sigma_y.Pa(), s.sigma_z.Pa(),
+                             s.tau_xy.Pa(), s.tau_xz.Pa(), s.tau_yz.Pa()));
+  }
+
+  void von_mises(const StressElement2Array& s, std::vector<double>& equivalent) {
+    const std::size_t count = s.size();
+    equivalent.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      equivalent[i] = von_mises2(s.sigma_x[i], s.sigma_y[i], s.tau_xy[i]);
+    }
+  }
+
+  void von_mises(const StressElement3Array& s, std::vector<double>& equivalent) {
+    const std::size_t count = s.size();
+    equivalent.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      equivalent[i] = von_mises3(s.sigma_x[i], s.sigma_y[i], s.sigma_z[i],
+                                 s.tau_xy[i], s.tau_xz[i], s.tau_yz[i]);
+    }
+  }
+
+  Stress tresca(const StressElement2& s) {
+    double s1, s3;
+    extreme_principal2(s.sigma_x.Pa(), s.sigma_y.Pa(), s.tau_xy.Pa(), s1, s3);
+    return Stress(s1 - s3);
+  }
+
+  Stress tresca(const StressElement3& s) {
+    const PrincipalStress3 principal = principal_stress(s);
+    return principal.sigma_1 - principal.sigma_3;
+  }
+
+  void tresca(const StressElement2Array& s, std::vector<double>& equivalent) {
+    const std::size_t count = s.size();
+    equivalent.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      double s1, s3;
+      extreme_principal2(s.sigma_x[i], s.sigma_y[i], s.tau_xy[i], s1, s3);
+      equivalent[i] = s1 - s3;
+    }
+  }
+
+  void tresca(const StressElement3Array& s, std::vector<double>& equivalent) {
+    const std::size_t count = s.size();
+    equivalent.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      double s1, s2, s3;
+      internal::principal_values(s.sigma_x[i], s.sigma_y[i], s.sigma_z[i],
+                                 s.tau_xy[i], s.tau_xz[i], s.tau_yz[i], s1, s2, s3);
+      equivalent[i] = s1 - s3;
+    }
+  }
+
+  double factor_of_safety_von_mises(const StressElement2& s, const Material& material) {
+    return material.Sy()/von_mises(s);
+  }
+
+  double factor_of_safety_von_mises(const StressElement3& s, const Material& material) {
+    return material.Sy()/von_mises(s);
+  }
+
+  double factor_of_safety_von_mises(const StressElement2Array& s, const Material& material,
+                                    std::vector<double>& n) {
+    von_mises(s, n);
+    return factors_of_safety(n, material.Sy().Pa(), n);
+  }
+
+  double factor_of_safety_von_mises(const StressElement3Array& s, const Material& material,
+                                    std::vector<double>& n) {
+    von_mises(s, n);
+    return factors_of_safety(n, material.Sy().Pa(), n);
+  }
+
+  double factor_of_safety_von_mises(const StressElement2Array& s,
+                                    const MaterialPropertyArray& materials,
+                                    const std::vector<MaterialHandle>& handles,
+                                    std::vector<double>& n) {
+    von_mises(s, n);
+    return factors_of_safety(n, materials, handles, n);
+  }
+
+  double factor_of_safety_von_mises(const StressElement3Array& s,
+                                    const MaterialPropertyArray& materials,
+                                    const std::vector<MaterialHandle>& handles,
+                                    std::vector<double>& n) {
+    von_mises(s, n);
+    return factors_of_safety(n, materials, handles, n);
+  }
+
+  double factor_of_safety_tresca(const StressElement2& s, const Material& material) {
+    return material.Sy()/tresca(s);
+  }
+
+  double factor_of_safety_tresca(const StressElement3& s, const Material& material) {
+    return material.Sy()/tresca(s);
+  }
+
+  double factor_of_safety_tresca(const StressElement2Array& s, const Material& material,
+                                 std::vector<double>& n) {
+    tresca(s, n);
+    return factors_of_safety(n, material.Sy().Pa(), n);
+  }
+
+  double factor_of_safety_tresca(const StressElement3Array& s, const Material& material,
+                                 std::vector<double>& n) {
+    tresca(s, n);
+    return factors_of_safety(n, material.Sy().Pa(), n);
+  }
+
+  double factor_of_safety_mohr_coulomb(const StressElement2& s, const Material& material,
+                                       const Stress& compressive_strength) {
+    double s1, s3;
+    extreme_principal2(s.sigma_x.Pa(), s.sigma_y.Pa(), s.tau_xy.Pa(), s1, s3);
+    return mohr_coulomb(s1, s3, material.St().Pa(), compressive_strength.Pa());
+  }
+
+  double factor_of_safety_mohr_coulomb(const StressElement3& s, const Material& material,
+                                       const Stress& compressive_strength) {
+    const PrincipalStress3 principal = principal_stress(s);
+    return mohr_coulomb(principal.sigma_1.Pa(), principal.sigma_3.Pa(),
+                        material.St().Pa(), compressive_strength.Pa());
+  }
+
+  double factor_of_safety_mohr_coulomb(const StressElement2Array& s, const Material& material,
+                                       const Stress& compressive_strength,
+                                       std::vector<double>& n) {
+    const double St = material.St().Pa();
+    const double Sc = compressive_strength.Pa();
+    const std::size_t count = s.size();
+    n.resize(count);
+    double least = std::numeric_limits<double>::infinity();
+    for (std::size_t i = 0; i < count; ++i) {
+      double s1, s3;
+      extreme_principal2(s.sigma_x[i], s.sigma_y[i], s.tau_xy[i], s1, s3);
+      n[i] = mohr_coulomb(s1, s3, St, Sc);
+      least = std::min(least, n[i]);
+    }
+    return least;
+  }
+
+  double factor_of_safety_mohr_coulomb(const StressElement3Array& s, const Material& material,
+                                       const Stress& compressive_strength,
+                                       std::vector<double>& n) {
+    const double St = material.St().Pa();
+    const double Sc = compressive_strength.Pa();
+    const std::size_t count = s.size();
+    n.resize(count);
+    double least = std::numeric_limits<double>::infinity();
+    for (std::size_t i = 0; i < count; ++i) {
+      double s1, s2, s3;
+      internal::principal_values(s.sigma_x[i], s.sigma_y[i], s.sigma_z[i],
+                                 s.tau_xy[i], s.tau_xz[i], s.tau_yz[i], s1, s2, s3);
+      n[i] = mohr_coulomb(s1, s3, St, Sc);
+      least = std::min(least, n[i]);
+    }
+    return least;
+  }
+
+  Stress endurance_limit(const Material& material) {
+    // Steels with a tensile strength over 1400 MPa level off at 700 MPa
+    return material.St() > 1400_MPa ? 700_MPa : material.St()/2;
+  }
+
+  double factor_of_safety_goodman(const StressElement2& alternating, const StressElement2& mean,
+                                  const Material& material, const Stress& endurance) {
+    return goodman(von_mises(alternating).Pa(), von_mises(mean).Pa(),
+                   endurance.Pa(), material.St().Pa());
+  }
+
+  double factor_of_safety_goodman(const StressElement3& alternating, const StressElement3& mean,
+                                  const Material& material, const Stress& endurance) {
+    return goodman(von_mises(alternating).Pa(), von_mises(mean).Pa(),
+                   endurance.Pa(), material.St().Pa());
+  }
+
+  double factor_of_safety_goodman(const StressElement2Array& alternating,
+                                  const StressElement2Array& mean,
+                                  const Material& material, const Stress& endurance,
+                                  std::vector<double>& n) {
+    if (alternating.size() != mean.size()) {
+      n.clear();
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+    const double Se = endurance.Pa();
+    const double Sut = material.St().Pa();
+    const std::size_t count = alternating.size();
+    n.resize(count);
+    double least = std::numeric_limits<double>::infinity();
+    for (std::size_t i = 0; i < count; ++i) {
+      n[i] = goodman(von_mises2(alternating.sigma_x[i], alternating.sigma_y[i], alternating.tau_xy[i]),
+                     von_mises2(mean.sigma_x[i], mean.sigma_y[i], mean.tau_xy[i]), Se, Sut);
+      least = std::min(least, n[i]);
+    }
+    return least;
+  }
+
+  double factor_of_safety_goodman(const StressElement3Array& alternating,
+                                  const StressElement3Array& mean,
+                                  const Material& material, const Stress& endurance,
+                                  std::vector<double>& n) {
+    if (alternating.size() != mean.size()) {
+      n.clear();
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+    const double Se = endurance.Pa();
+    const double Sut = material.St().Pa();
+    const std::size_t count = alternating.size();
+    n.resize(count);
+    double least = std::numeric_limits<double>::infinity();
+    for (std::size_t i = 0; i < count; ++i) {
+      n[i] = goodman(von_mises3(alternating.sigma_x[i], alternating.sigma_y[i], alternating.sigma_z[i],
+                                alternating.tau_xy[i], alternating.tau_xz[i], alternating.tau_yz[i]),
+                     von_mises3(mean.sigma_x[i], mean.sigma_y[i], mean.sigma_z[i],
+                                mean.tau_xy[i], mean.tau_xz[i], mean.tau_yz[i]), Se, Sut);
+      least = std::min(least, n[i]);
+    }
+    return least;
+  }
+
+};  // namespace eng
@@ -0,0 +1,108 @@
+#pragma once
+
+/*****************************************************************//**
+ * \file  FailureCriteria.h
+ * \brief Equivalent stresses and factors of safety of stress elements for
+ *          ductile and brittle failure theories
+ *
+ * \author bltan
+ * \date   October 2026
+ *********************************************************************/
+
+#include <vector>
+
+#include "Material.h"
+#include "MaterialRegistry.h"
+#include "Stress.h"
+
+namespace eng {
+
+  /* Calculate the von Mises equivalent stress of a planar stress state */
+  Stress von_mises(const StressElement2& s);
+  /* Calculate the von Mises equivalent stress of a general 3D stress state */
+  Stress von_mises(const StressElement3& s);
+  /* Calculate the von Mises equivalent stress of many planar stress states */
+  void von_mises(const StressElement2Array& s, std::vector<double>& equivalent);
+  /* Calculate the von Mises equivalent stress of many 3D stress states */
+  void von_mises(const StressElement3Array& s, std::vector<double>& equivalent);
+
+  /* Calculate the Tresca equivalent stress, which is twice the maximum shear
+   * stress, of a planar stress state. The out of plane stress is zero. */
+  Stress tresca(const StressElement2& s);
+  /* Calculate the Tresca equivalent stress of a general 3D stress state */
+  Stress tresca(const StressElement3& s);
+  /* Calculate the Tresca equivalent stress of many planar stress states */
+  void tresca(const StressElement2Array& s, std::vector<double>& equivalent);
+  /* Calculate the Tresca equivalent stress of many 3D stress states */
+  void tresca(const StressElement3Array& s, std::vector<double>& equivalent);
+
+  /* Calculate the factor of safety against yield with the distortion energy
+   * theory for ductile materials. The batch versions return the smallest
+   * factor of safety. */
+  double factor_of_safety_von_mises(const StressElement2& s, const Material& material);
+  double factor_of_safety_von_mises(const StressElement3& s, const Material& material);
+  double factor_of_safety_von_mises(const StressElement2Array& s, const Material& material,
+                                    std::vector<double>& n);
+  double factor_of_safety_von_mises(const StressElement3Array& s, const Material& material,
+                                    std::vector<double>& n);
+  /* The batch versions where each element has the material of its handle in
+   * the properties. They return NaN with n emptied if there is not one
+   * handle per element, or a handle is not in the properties. */
+  double factor_of_safety_von_mises(const StressElement2Array& s,
+                                    const MaterialPropertyArray& materials,
+                                    const std::vector<MaterialHandle>& handles,
+                                    std::vector<double>& n);
+  double factor_of_safety_von_mises(const StressElement3Array& s,
+                                    const MaterialPropertyArray& materials,
+                                    const std::vector<MaterialHandle>& handles,
+                                    std::vector<double>& n);
+
+  /* Calculate the factor of safety against yield with the maximum shear
+   * stress theory for ductile materials. The batch versions return the
+   * smallest factor of safety. */
+  double factor_of_safety_tresca(const StressElement2& s, const Material& material);
+  double factor_of_safety_tresca(const StressElement3& s, const Material& material);
+  double factor_of_safety_tresca(const StressElement2Array& s, const Material& material,
+                                 std::vector<double>& n);
+  double factor_of_safety_tresca(const StressElement3Array& s, const Material& material,
+                                 std::vector<double>& n);
+
+  /* Calculate the factor of safety against fracture with the Coulomb-Mohr
+   * theory for brittle materials, with the ultimate tensile strength of the
+   * material and a separate ultimate compressive strength. The batch
+   * versions return the smallest factor of safety. */
+  double factor_of_safety_mohr_coulomb(const StressElement2& s, const Material& material,
+                                       const Stress& compressive_strength);
+  double factor_of_safety_mohr_coulomb(const StressElement3& s, const Material& material,
+                                       const Stress& compressive_strength);
+  double factor_of_safety_mohr_coulomb(const StressElement2Array& s, const Material& material,
+                                       const Stress& compressive_strength,
+                                       std::vector<double>& n);
+  double factor_of_safety_mohr_coulomb(const StressElement3Array& s, const Material& material,
+                                       const Stress& compressive_strength,
+                                       std::vector<double>& n);
+
+  /* Estimate the endurance limit of a steel specimen from its ultimate
+   * tensile strength, before any Marin modifying factors. */
+  Stress endurance_limit(const Material& material);
+
+  /* Calculate the factor of safety against fatigue with the modified Goodman
+   * criterion, using the von Mises equivalents of the alternating and mean
+   * stresses. The batch versions return the smallest factor of safety, and
+   * pair each alternating stress with the mean stress at the same index, so
+   * both arrays must be the same size. If they are not, n is emptied and
+   * NaN is returned. */
+  double factor_of_safety_goodman(const StressElement2& alternating, const StressElement2& mean,
+                                  const Material& material, const Stress& endurance);
+  double factor_of_safety_goodman(const StressElement3& alternating, const StressElement3& mean,
+                                  const Material& material, const Stress& endurance);
+  double factor_of_safety_goodman(const StressElement2Array& alternating,
+                                  const StressElement2Array& mean,
+                                  const Material& material, const Stress& endurance,
+                                  std::vector<double>& n);
+  double factor_of_safety_goodman(const StressElement3Array& alternating,
+                                  const StressElement3Array& mean,
+                                  const Material& material, const Stress& endurance,
+                                  std::vector<double>& n);
+
+};  // namespace eng
@@ -0,0 +1,233 @@
+#include "pch.h"
+#include "Fastener.h"
+#include "Designation.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace eng {
+
+  namespace {
+
+    constexpr double mm = 0.001;
+    constexpr double MPa = 1e6;
+
+    // Metric coarse threads, from Shigley Table 8-1
+    constexpr std::array<BoltSize, 11> sizes = {
+      BoltSize("M5", 5*mm, 0.8*mm, 14.2*mm*mm),
+      BoltSize("M6", 6*mm, 1.0*mm, 20.1*mm*mm),
+      BoltSize("M8", 8*mm, 1.25*mm, 36.6*mm*mm),
+      BoltSize("M10", 10*mm, 1.5*mm, 58.0*mm*mm),
+      BoltSize("M12", 12*mm, 1.75*mm, 84.3*mm*mm),
+      BoltSize("M14", 14*mm, 2.0*mm, 115*mm*mm),
+      BoltSize("M16", 16*mm, 2.0*mm, 157*mm*mm),
+      BoltSize("M20", 20*mm, 2.5*mm, 245*mm*mm),
+      BoltSize("M24", 24*mm, 3.0*mm, 353*mm*mm),
+      BoltSize("M30", 30*mm, 3.5*mm, 561*mm*mm),
+      BoltSize("M36", 36*mm, 4.0*mm, 817*mm*mm),
+    };
+
+    // Metric property classes, from Shigley Table 8-11
+    constexpr std::array<BoltGrade, 7> grades = {
+      BoltGrade("4.6", 5*mm, 36*mm, 225*MPa, 240*MPa, 400*MPa),
+      BoltGrade("4.8", 1.6*mm, 16*mm, 310*MPa, 340*MPa, 420*MPa),
+      BoltGrade("5.8", 5*mm, 24*mm, 380*MPa, 420*MPa, 520*MPa),
+      BoltGrade("8.8", 16*mm, 36*mm, 600*MPa, 660*MPa, 830*MPa),
+      BoltGrade("9.8", 1.6*mm, 16*mm, 650*MPa, 720*MPa, 900*MPa),
+      BoltGrade("10.9", 5*mm, 36*mm, 830*MPa, 940*MPa, 1040*MPa),
+      BoltGrade("12.9", 1.6*mm, 36*mm, 970*MPa, 1100*MPa, 1220*MPa),
+    };
+
+    // Shigley's standard thread length of a metric bolt of length L
+    double thread_length(const double& d, const double& L) {
+      return 2*d + (L <= 125*mm ? 6*mm : (L <= 200*mm ? 12*mm : 25*mm));
+    }
+
+  };  // namespace
+
+  Area BoltSize::Ad() const {
+    return Area(pi*_d*_d/4);
+  }
+
+  bool BoltGrade::available(const BoltSize& size) const {
+    return size.d().value() >= _min_d && size.d().value() <= _max_d;
+  }
+
+  namespace metric_bolts {
+
+    const BoltSize* find(std::string_view designation) {
+      for (const auto& size : sizes) {
+        if (designation::same(size.designation(), designation)) {
+          return &size;
+        }
+      }
+      return nullptr;
+    }
+
+    const BoltGrade* find_grade(std::string_view designation) {
+      for (const auto& grade : grades) {
+        if (designation::same(grade.designation(), designation)) {
+          return &grade;
+        }
+      }
+      return nullptr;
+    }
+
+    std::size_t size() {
+      return sizes.size();
+    }
+
+    const BoltSize* begin() {
+      return sizes.data();
+    }
+
+    const BoltSize* end() {
+      return sizes.data() + sizes.size();
+    }
+
+    std::size_t grade_count() {
+      return grades.size();
+    }
+
+    const BoltGrade* grades_begin() {
+      return grades.data();
+    }
+
+    const BoltGrade* grades_end() {
+      return grades.data() + grades.size();
+    }
+
+  };  // namespace metric_bolts
+
+  /*
+   * BoltedJointSearch
+   */
+
+  double BoltedJointSearch::Candidate::factor() const {
+    return std::min(load, separation);
+  }
+
+  void BoltedJointSearch::Batch::resize(const std::size_t& n) {
+    size_index.resize(n);
+    grade_index.resize(n);
+    At.resize(n);
+    Sp.resize(n);
+    preload.resize(n);
+    C.resize(n);
+    yield.resize(n);
+    load.resize(n);
+    separation.resize(n);
+  }
+
+  BoltedJointSearch::BoltedJointSearch(const std::vector<joint_member>& members,
+                                       const Stress& E) :
+    _fractions{0.75, 0.9},
+    _required(1) {
+    const double grip = joint_thickness(members).value();
+    _kb.reserve(sizes.size());
+    _km.reserve(sizes.size());
+    for (const auto& size : sizes) {
+      // the bolt is taken as long enough for the grip and a nut, with the
+      //   threaded part of the grip ending at the standard thread length
+      const double d = size.d().value();
+      const double ld = std::min(std::max(grip + d - thread_length(d, grip + d), 0.0), grip);
+      const double lt = grip - ld;
+      _kb.push_back(bolt_stiffness(size.Ad(), size.At(), E, Length(lt), Length(ld)).value());
+      _km.push_back(members_stiffness(members, size.d()).value());
+    }
+  }
+
+  BoltedJointSearch& BoltedJointSearch::preloads(const std::vector<double>& fractions) {
+    _fractions = fractions;
+    return *this;
+  }
+
+  BoltedJointSearch& BoltedJointSearch::require(const double& factor) {
+    _required = factor;
+    return *this;
+  }
+
+  void BoltedJointSearch::candidates(Batch& batch) const {
+    batch.resize(0);
+    for (std::size_t s = 0; s != sizes.size(); ++s) {
+      for (std::size_t g = 0; g != grades.size(); ++g) {
+        if (!grades[g].available(sizes[s])) {
+          continue;
+        }
+        const double At = sizes[s].At().value();
+        const double Sp = grades[g].Sp().Pa();
+        for (const auto& fraction : _fractions) {
+          batch.size_index.push_back(static_cast<unsigned>(s));
+          batch.grade_index.push_back(static_cast<unsigned>(g));
+          batch.At.push_back(At);
+          batch.Sp.push_back(Sp);
+          batch.preload.push_back(fraction*Sp*At);
+          batch.C.push_back(_kb[s]/(_kb[s] + _km[s]));
+        }
+      }
+    }
+    batch.yield.resize(batch.size());
+    batch.load.resize(batch.size());
+    batch.separation.resize(batch.size());
+  }
+
+  void BoltedJointSearch::evaluate(const Force& P, Batch& batch) const {
+    const std::size_t n = batch.size();
+    const double p = P.N();
+    for (std::size_t i = 0; i < n; ++i) {
+      const double proof = batch.Sp[i]*batch.At[i];
+      const double C = batch.C[i];
+      const double Fi = batch.preload[i];
+      batch.yield[i] = proof/(C*p + Fi);
+      batch.load[i] = p > 0 ? (proof - Fi)/(C*p) : HUGE_VAL;
+      batch.separation[i] = p > 0 ? Fi/(p*(1 - C)) : HUGE_VAL;
+    }
+  }
+
+  std::vector<BoltedJointSearch::Candidate> BoltedJointSearch::pareto(const Force& P) const {
+    Batch batch;
+    candidates(batch);
+    evaluate(P, batch);
+
+    std::vector<Candidate> feasible;
+    for (std::size_t i = 0; i != batch.size(); ++i) {
+      Candidate c{&sizes[batch.size_index[i]], &grades[batch.grade_index[i]],
+                  Force(batch.preload[i]), batch.C[i],
+                  batch.yield[i], batch.load[i], batch.separation[i]};
+      if (c.yield >= 1 && c.factor() >= _required) {
+        feasible.push_back(c);
+      }
+    }
+
+    // Sorted by area, then proof strength, then the best factor of safety
+    //   first, a candidate is dominated only by one before it
+    std::sort(feasible.begin(), feasible.end(), [](const Candidate& lh, const Candidate& rh) {
+      if (lh.size->At() != rh.size->At()) {
+        return lh.size->At() < rh.size->At();
+      }
+      if (lh.grade->Sp() != rh.grade->Sp()) {
+        return lh.grade->Sp() < rh.grade->Sp();
+      }
+      return lh.factor() > rh.factor();
+    });
+    std::vector<Candidate> optimal;
+    for (const auto& c : feasible) {
+      const bool dominated = std::any_of(optimal.begin(), optimal.end(), [&](const Candidate& o) {
+        return o.size->At() <= c.size->At() && o.grade->Sp() <= c.grade->Sp()
+          && o.factor() >= c.factor();
+      });
+      if (!dominated) {
+        optimal.push_back(c);
+      }
+    }
+    return optimal;
+  }
+
+  std::vector<BoltedJointSearch::Candidate> BoltedJointSearch::pareto(
+    const std::vector<double>& tension) const {
+    const double P = tension.empty() ? 0 : *std::max_element(tension.begin(), tension.end());
+    return pareto(Force(P));
+  }
+
+};  // namespace eng
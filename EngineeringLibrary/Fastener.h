@@ -0,0 +1,218 @@
+#pragma once
+
+/*****************************************************************//**
+ * \file  Fastener.h
+ * \brief A catalog of metric bolt sizes and property classes, and a search
+ *          of them for the Pareto optimal bolts of a joint
+ *
+ * \author bltan
+ * \date   October 2026
+ *********************************************************************/
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include "Bolt.h"
+#include "Material.h"
+
+#include "Units/Area.h"
+#include "Units/Force.h"
+#include "Units/Length.h"
+#include "Units/Stiffness.h"
+
+namespace eng {
+
+  /**
+   * \class BoltSize A metric coarse thread bolt size. BoltSizes are stored
+   *    in a compile time table, so they are only ever accessed by pointer or
+   *    reference.
+   */
+  class BoltSize {
+  public:
+    /**
+     * \brief BoltSize constructor, which is used to build the catalog
+     *
+     * \param designation The designation of the size, such as "M12"
+     * \param d The major diameter in meters
+     * \param pitch The thread pitch in meters
+     * \param At The tensile stress area in m^2
+     */
+    constexpr BoltSize(const char* designation, double d, double pitch, double At) :
+      _designation(),
+      _d(d),
+      _pitch(pitch),
+      _At(At) {
+      for (std::size_t i = 0; i != sizeof(_designation) - 1 && designation[i] != '\0'; ++i) {
+        _designation[i] = designation[i];
+      }
+    }
+
+    constexpr std::string_view designation() const { return _designation; }
+    Length d() const { return Length(_d); }
+    Length pitch() const { return Length(_pitch); }
+    /* The area of the unthreaded shank */
+    Area Ad() const;
+    /* The tensile stress area of the thread */
+    Area At() const { return Area(_At); }
+
+  private:
+    char _designation[8];
+    double _d;
+    double _pitch;
+    double _At;
+  };
+
+  /**
+   * \class BoltGrade A metric property class of bolt, and the range of sizes
+   *    it is made in
+   */
+  class BoltGrade {
+  public:
+    /**
+     * \brief BoltGrade constructor, which is used to build the catalog
+     *
+     * \param designation The property class, such as "8.8"
+     * \param min_d The smallest diameter of the class in meters
+     * \param max_d The largest diameter of the class in meters
+     * \param Sp The minimum proof strength in Pa
+     * \param Sy The minimum yield strength in Pa
+     * \param St The minimum tensile strength in Pa
+     */
+    constexpr BoltGrade(const char* designation, double min_d, double max_d, double Sp,
+                        double Sy, double St) :
+      _designation(),
+      _min_d(min_d),
+      _max_d(max_d),
+      _Sp(Sp),
+      _Sy(Sy),
+      _St(St) {
+      for (std::size_t i = 0; i != sizeof(_designation) - 1 && designation[i] != '\0'; ++i) {
+        _designation[i] = designation[i];
+      }
+    }
+
+    constexpr std::string_view designation() const { return _designation; }
+    Stress Sp() const { return Stress(_Sp); }
+    Stress Sy() const { return Stress(_Sy); }
+    Stress St() const { return Stress(_St); }
+
+    /* If bolts of this class are made in a size */
+    bool available(const BoltSize& size) const;
+
+  private:
+    char _designation[8];
+    double _min_d;
+    double _max_d;
+    double _Sp;
+    double _Sy;
+    double _St;
+  };
+
+  namespace metric_bolts {
+
+    /* Find a size by its designation, such as "M12", ignoring letter case.
+     * Returns nullptr if it is not in the catalog. */
+    const BoltSize* find(std::string_view designation);
+    /* Find a property class by its designation, such as "10.9". Returns
+     * nullptr if it is not in the catalog. */
+    const BoltGrade* find_grade(std::string_view designation);
+
+    std::size_t size();
+    const BoltSize* begin();
+    const BoltSize* end();
+
+    std::size_t grade_count();
+    const BoltGrade* grades_begin();
+    const BoltGrade* grades_end();
+
+  };  // namespace metric_bolts
+
+  /**
+   * \class BoltedJointSearch Evaluates every size, property class and
+   *    preload in the catalog for a joint, and finds the candidates which are
+   *    Pareto optimal in a small stress area, a low proof strength and a
+   *    large factor of safety.
+   *
+   *    The bolt and member stiffnesses only depend on the size, so they are
+   *    found once per size when the search is built. The candidates are then
+   *    evaluated as parallel arrays with the same equations as
+   *    factor_of_safety_yield, factor_of_safety_load and
+   *    factor_of_safety_separation.
+   */
+  class BoltedJointSearch {
+  public:
+    /** A bolt for the joint and its factors of safety */
+    struct Candidate {
+      const BoltSize* size;
+      const BoltGrade* grade;
+      Force preload;
+      double C;               /**< The stiffness constant of the joint */
+      double yield;
+      double load;
+      double separation;
+
+      /* The smaller of the load and separation factors of safety */
+      double factor() const;
+    };
+
+    /** A batch of candidates as parallel arrays in SI units */
+    struct Batch {
+      std::vector<unsigned> size_index;   /**< The index of the size in the catalog */
+      std::vector<unsigned> grade_index;  /**< The index of the class in the catalog */
+      std::vector<double> At;
+      std::vector<double> Sp;
+      std::vector<double> preload;
+      std::vector<double> C;
+
+      std::vector<double> yield;
+      std::vector<double> load;
+      std::vector<double> separation;
+
+      std::size_t size() const { return At.size(); }
+      void resize(const std::size_t& n);
+    };
+
+    /**
+     * \brief BoltedJointSearch constructor
+     *
+     * \param members The members clamped by each bolt, whose total thickness
+     *   is the grip
+     * \param E Young's modulus of the bolts
+     */
+    BoltedJointSearch(const std::vector<joint_member>& members, const Stress& E = 207_GPa);
+
+    /** Set the preloads to try, as fractions of the proof load. The default
+     *    is 0.75 for reused bolts and 0.9 for permanent joints. */
+    BoltedJointSearch& preloads(const std::vector<double>& fractions);
+    /** Require a minimum factor of safety against overload and separation,
+     *    1 by default. */
+    BoltedJointSearch& require(const double& factor);
+
+    /* Fill a batch with every size, class and preload in the catalog */
+    void candidates(Batch& batch) const;
+    /* Calculate the factors of safety of a batch of candidates under the
+     * external tension on each bolt */
+    void evaluate(const Force& P, Batch& batch) const;
+
+    /**
+     * \brief Find the Pareto optimal candidates which meet the required
+     *   factor of safety
+     *
+     * \param P The largest external tension on any bolt of the joint, which
+     *   governs all three factors of safety
+     * \return The optimal candidates, from the smallest stress area up
+     */
+    std::vector<Candidate> pareto(const Force& P) const;
+    /* Find the Pareto optimal candidates for the tension on every bolt of a
+     * group, such as BoltGroupResults::tension */
+    std::vector<Candidate> pareto(const std::vector<double>& tension) const;
+
+  private:
+    std::vector<double> _kb;      /**< The bolt stiffness of each size */
+    std::vector<double> _km;      /**< The member stiffness of each size */
+    std::vector<double> _fractions;
+    double _required;
+  };
+
+};  // namespace eng
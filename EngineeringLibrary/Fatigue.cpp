@@ -0,0 +1,146 @@
+#include "pch.h"
+#include "Fatigue.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "FailureCriteria.h"
+
+namespace eng {
+
+  /*
+   * SNCurve
+   */
+
+  SNCurve::SNCurve(const Stress& a, const double& b, const Stress& endurance) :
+    _a(a.Pa()),
+    _b(b),
+    _endurance(endurance.Pa()) { }
+
+  SNCurve::SNCurve(const Material& material) :
+    _endurance(endurance_limit(material).Pa()) {
+    // the fatigue strength fraction at 10^3 cycles
+    const double f = 0.9;
+    const double low_cycle = f*material.St().Pa();
+    _a = low_cycle*low_cycle/_endurance;
+    _b = -std::log10(low_cycle/_endurance)/3;
+  }
+
+  Stress SNCurve::strength(const double& cycles) const {
+    return Stress(std::max(_a*std::pow(cycles, _b), _endurance));
+  }
+
+  double SNCurve::cycles(const Stress& amplitude) const {
+    if (amplitude.Pa() < _endurance) {
+      return std::numeric_limits<double>::infinity();
+    }
+    return std::pow(amplitude.Pa()/_a, 1/_b);
+  }
+
+  double SNCurve::damage(const double& amplitude) const {
+    return amplitude < _endurance ? 0 : std::pow(amplitude/_a, -1/_b);
+  }
+
+  /*
+   * RainflowCounter
+   */
+
+  RainflowCounter::RainflowCounter(const SNCurve& curve, const Stress& bin_width,
+                                   const std::size_t& bins) :
+    _curve(curve),
+    // NaN fails the comparison too, so only a positive width is kept
+    _bin_width(bin_width.Pa() > 0 ? bin_width.Pa() : std::numeric_limits<double>::infinity()),
+    _histogram(bin_width.Pa() > 0 ? std::max(bins, std::size_t(1)) : 1, 0.0),
+    _cycles(0),
+    _damage(0),
+    _last(0),
+    _direction(0),
+    _started(false) { }
+
+  void RainflowCounter::add(const Stress& sample) {
+    add(&sample, 1);
+  }
+
+  void RainflowCounter::add(const std::vector<Stress>& samples) {
+    add(samples.data(), samples.size());
+  }
+
+  void RainflowCounter::add(const Stress* samples, const std::size_t& count) {
+    std::size_t i = 0;
+    if (!_started && count != 0) {
+      _last = samples[0].Pa();
+      _started = true;
+      turning_point(_last);
+      i = 1;
+    }
+
+    // Most samples only continue the current direction, so keep the state in
+    //   locals and only leave the loop's fast path at a reversal
+    double last = _last;
+    int direction = _direction;
+    for (; i < count; ++i) {
+      const double s = samples[i].Pa();
+      const int step = (s > last) - (s < last);
+      if (step == -direction && step != 0) {
+        turning_point(last);
+      }
+      direction = step != 0 ? step : direction;
+      last = s;
+    }
+    _last = last;
+    _direction = direction;
+  }
+
+  void RainflowCounter::reset() {
+    std::fill(_histogram.begin(), _histogram.end(), 0.0);
+    _cycles = 0;
+    _damage = 0;
+    _residue.clear();
+    _last = 0;
+    _direction = 0;
+    _started = false;
+  }
+
+  double RainflowCounter::total_damage() const {
+    double damage = _damage;
+    // the last sample is where the history would end
+    for (std::size_t i = 0; i < _residue.size(); ++i) {
+      const double next = i + 1 < _residue.size() ? _residue[i + 1] : _last;
+      damage += _curve.damage(std::fabs(next - _residue[i])/2)/2;
+    }
+    return damage;
+  }
+
+  void RainflowCounter::turning_point(const double& s) {
+    _residue.push_back(s);
+
+    // With four turning points A, B, C and D, the range B-C is a closed cycle
+    //   if it is no larger than the ranges on either side of it
+    std::size_t n = _residue.size();
+    while (n >= 4) {
+      const double a = _residue[n - 4];
+      const double b = _residue[n - 3];
+      const double c = _residue[n - 2];
+      const double d = _residue[n - 1];
+      const double inner = std::fabs(c - b);
+      if (inner > std::fabs(b - a) || inner > std::fabs(d - c)) {
+        break;
+      }
+      count(inner);
+      _residue[n - 3] = d;
+      n -= 2;
+      _residue.resize(n);
+    }
+  }
+
+  void RainflowCounter::count(const double& range) {
+    // clamp before converting, since a huge range overflows the conversion
+    const double last = static_cast<double>(_histogram.size() - 1);
+    const std::size_t bin = static_cast<std::size_t>(std::min(range/_bin_width, last));
+    _histogram[bin] += 1;
+    _cycles += 1;
+    _damage += _curve.damage(range/2);
+  }
+
+};  // namespace eng
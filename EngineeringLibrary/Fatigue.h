@@ -0,0 +1,124 @@
+#pragma once
+
+/*****************************************************************//**
+ * \file  Fatigue.h
+ * \brief Rainflow cycle counting of stress histories and fatigue damage
+ *          accumulation with Miner's rule
+ *
+ * \author bltan
+ * \date   October 2026
+ *********************************************************************/
+
+#include <cstddef>
+#include <vector>
+
+#include "Material.h"
+#include "Stress.h"
+
+namespace eng {
+
+  /**
+   * \class SNCurve The stress-life curve of a material, S = a*N^b, down to
+   *    the endurance limit, below which the life is infinite.
+   */
+  class SNCurve {
+  public:
+    /**
+     * \brief SNCurve constructor
+     *
+     * \param a The fatigue strength coefficient
+     * \param b The fatigue strength exponent, which is negative
+     * \param endurance The endurance limit
+     */
+    SNCurve(const Stress& a, const double& b, const Stress& endurance);
+    /**
+     * \brief SNCurve constructor which estimates the curve of a steel through
+     *   0.9*St at 10^3 cycles and the endurance limit at 10^6 cycles
+     *
+     * \param material The material
+     */
+    SNCurve(const Material& material);
+
+    Stress a() const { return Stress(_a); }
+    double b() const { return _b; }
+    Stress endurance() const { return Stress(_endurance); }
+
+    /* Calculate the fatigue strength at a number of cycles */
+    Stress strength(const double& cycles) const;
+    /* Calculate the number of cycles to failure at a fully reversed stress
+     * amplitude, which is infinite below the endurance limit */
+    double cycles(const Stress& amplitude) const;
+    /* Calculate the damage of one cycle of a stress amplitude in Pa */
+    double damage(const double& amplitude) const;
+
+  private:
+    double _a;
+    double _b;
+    double _endurance;
+  };
+
+  /**
+   * \class RainflowCounter Counts the cycles of a stress history as it
+   *    arrives with the four point rainflow algorithm, bins their ranges into
+   *    a histogram and accumulates their damage with Miner's rule.
+   *
+   *    Only the turning points which have not yet closed a cycle are kept,
+   *    so the memory used does not grow with the length of the history. Each
+   *    counter is independent, so channels can be counted on separate
+   *    threads with one counter per channel.
+   */
+  class RainflowCounter {
+  public:
+    /**
+     * \brief RainflowCounter constructor
+     *
+     * \param curve The S-N curve to calculate the damage of each cycle with
+     * \param bin_width The width of each stress range bin in the histogram.
+     *   A width which is not positive is rejected, and the histogram has a
+     *   single bin of infinite width which counts every range.
+     * \param bins The number of bins, where the last bin also counts all
+     *   larger ranges
+     */
+    RainflowCounter(const SNCurve& curve, const Stress& bin_width, const std::size_t& bins);
+
+    /* Add the next sample of the stress history */
+    void add(const Stress& sample);
+    /* Add the next chunk of samples of the stress history */
+    void add(const Stress* samples, const std::size_t& count);
+    void add(const std::vector<Stress>& samples);
+
+    /* Forget all samples and counted cycles */
+    void reset();
+
+    /* The number of full cycles counted so far */
+    double cycles() const { return _cycles; }
+    /* The number of full cycles in each stress range bin */
+    const std::vector<double>& histogram() const { return _histogram; }
+    Stress bin_width() const { return Stress(_bin_width); }
+
+    /* The Miner's rule damage of the full cycles counted so far */
+    double damage() const { return _damage; }
+    /* The damage of the full cycles, plus the turning points which have not
+     * closed a cycle counted as half cycles, as if the history ended now */
+    double total_damage() const;
+
+  private:
+    void turning_point(const double& s);
+    void count(const double& range);
+
+    SNCurve _curve;
+    double _bin_width;
+    std::vector<double> _histogram;
+
+    double _cycles;
+    double _damage;
+
+    /* The turning points which have not closed a cycle yet */
+    std::vector<double> _residue;
+    /* The last sample, and the direction the history is moving in */
+    double _last;
+    int _direction;
+    bool _started;
+  };
+
+};  // namespace eng
@@ -25,3 +25,13 @@
 // Rectangles
 #include "Geometric\Rectangle.h"
 #include "Geometric\HollowRectangle.h"
+
+// Composite sections
+#include "Geometric\CompositeSection.h"
+#include "Geometric\ThinWalledSection.h"
+
+// Standard sections
+#include "Geometric\SteelSection.h"
+
+// Section design
+#include "Geometric\SectionOptimizer.h"
@@ -9,6 +9,10 @@ namespace eng {
              pi*d*d*d*d/64, 
              pi*d*d*d*d/64, 
              0_m4,
-             c) { }
+             c,
+             Extents(d/2, d/2, d/2, d/2),
+             d*d*d/6,
+             d*d*d/6,
+             TorsionProperties(pi*d*d*d*d/32, WarpingConstant(0), c)) { }
 
 };  // namespace eng
@@ -0,0 +1,103 @@
+#include "pch.h"
+#include "CompositeSection.h"
+
+#include <cmath>
+#include <algorithm>
+
+namespace eng {
+
+  CompositeSection& CompositeSection::add(const Geometry& piece) {
+    accumulate(piece, 1.0);
+    return *this;
+  }
+
+  CompositeSection& CompositeSection::subtract(const Geometry& piece) {
+    accumulate(piece, -1.0);
+    return *this;
+  }
+
+  void CompositeSection::clear() {
+    *this = CompositeSection();
+  }
+
+  Geometry CompositeSection::geometry() const {
+    const double A = area_.value();
+    if (A == 0) {
+      return Geometry(0_m2, 0_m4, 0_m4, 0_m4, origin_);
+    }
+
+    // centroid relative to the origin
+    const double x = Qy_.value() / A;
+    const double y = Qx_.value() / A;
+    const double z = Qz_.value() / A;
+
+    // shift the second moments from the origin back to the centroid once
+    const Area area(A);
+    const SecondMomentOfArea ixx(Ixx_.value() - A*y*y);
+    const SecondMomentOfArea iyy(Iyy_.value() - A*x*x);
+    const SecondMomentOfArea ixy(Ixy_.value() - A*x*y);
+    const LengthVec centroid = origin_ + LengthVec(Length(x), Length(y), Length(z));
+
+    if (!has_bounds_ || !has_added_) {
+      return Geometry(area, ixx, iyy, ixy, centroid);
+    }
+    return Geometry(area, ixx, iyy, ixy, centroid,
+                    Extents(Length(max_y_ - y), Length(y - min_y_),
+                            Length(x - min_x_), Length(max_x_ - x)));
+  }
+
+  void CompositeSection::accumulate(const Geometry& piece, const double& sign) {
+    // Take moments about the first piece's centroid, which keeps the parallel
+    //   axis terms small and limits cancellation in geometry()
+    if (!has_origin_) {
+      origin_ = piece.centroid();
+      has_origin_ = true;
+    }
+
+    const LengthVec c = piece.centroid();
+    const double A = sign * piece.area().value();
+    const double x = (c.x() - origin_.x()).value();
+    const double y = (c.y() - origin_.y()).value();
+    const double z = (c.z() - origin_.z()).value();
+
+    area_.add(A);
+    Qx_.add(A*y);
+    Qy_.add(A*x);
+    Qz_.add(A*z);
+    Ixx_.add(sign*piece.Ixx().value() + A*y*y);
+    Iyy_.add(sign*piece.Iyy().value() + A*x*x);
+    Ixy_.add(sign*piece.Ixy().value() + A*x*y);
+
+    // removed pieces never extend the bounds of the section
+    if (sign > 0 && has_bounds_) {
+      const auto e = piece.extents();
+      if (!e) {
+        has_bounds_ = false;
+      } else if (!has_added_) {
+        max_y_ = y + e->top.value();
+        min_y_ = y - e->bottom.value();
+        min_x_ = x - e->left.value();
+        max_x_ = x + e->right.value();
+        has_added_ = true;
+      } else {
+        max_y_ = std::max(max_y_, y + e->top.value());
+        min_y_ = std::min(min_y_, y - e->bottom.value());
+        min_x_ = std::min(min_x_, x - e->left.value());
+        max_x_ = std::max(max_x_, x + e->right.value());
+      }
+    }
+
+    ++count_;
+  }
+
+  void CompositeSection::CompensatedSum::add(const double& x) {
+    const double t = sum + x;
+    if (std::fabs(sum) >= std::fabs(x)) {
+      compensation += (sum - t) + x;
+    } else {
+      compensation += (x - t) + sum;
+    }
+    sum = t;
+  }
+
+};  // namespace eng
@@ -0,0 +1,98 @@
+#pragma once
+
+/*****************************************************************//**
+ * \file   CompositeSection.h
+ * \brief  A builder which combines many geometries into one composite
+ *           section in a single pass
+ *
+ *
+ * \author bltan
+ * \date   October 2026
+ *********************************************************************/
+
+#include <cstddef>
+
+#include "Geometry.h"
+
+namespace eng {
+
+  /** Accumulates the area, first moments and second moments of many pieces
+   *    about one fixed origin and produces the composite Geometry once. This
+   *    avoids the repeated parallel axis shifts of chaining operator+ and
+   *    operator- for sections built from many pieces.
+   * \class CompositeSection
+   * \addtogroup Geometric
+   */
+  class CompositeSection {
+  public:
+    CompositeSection() = default;
+
+    /**
+     * \brief Add a piece to the section
+     *
+     * \param piece The Geometry to add
+     * \return this CompositeSection
+     */
+    CompositeSection& add(const Geometry& piece);
+    /**
+     * \brief Remove a piece, such as a hole, from the section
+     *
+     * \param piece The Geometry to remove
+     * \return this CompositeSection
+     */
+    CompositeSection& subtract(const Geometry& piece);
+
+    CompositeSection& operator+= (const Geometry& piece) { return add(piece); }
+    CompositeSection& operator-= (const Geometry& piece) { return subtract(piece); }
+
+    /** Returns the number of pieces added to or removed from the section.
+     */
+    std::size_t size() const { return count_; }
+
+    /** Remove all pieces from the section.
+     */
+    void clear();
+
+    /**
+     * \brief Calculate the composite Geometry about its own centroid
+     *
+     * \return The Geometry of all pieces in the section
+     */
+    Geometry geometry() const;
+
+  private:
+    /* Neumaier's compensated summation, which keeps the rounding error of
+     * long sums independent of the number of pieces. */
+    struct CompensatedSum {
+      double sum = 0;
+      double compensation = 0;
+
+      void add(const double& x);
+      double value() const { return sum + compensation; }
+    };
+
+    void accumulate(const Geometry& piece, const double& sign);
+
+    std::size_t count_ = 0;
+    bool has_origin_ = false;
+    LengthVec origin_;          /**< The fixed point all moments are taken about */
+
+    /* The bounding box of all added pieces relative to the origin. The bounds
+     * are unknown if any added piece has unknown bounds. */
+    bool has_bounds_ = true;
+    bool has_added_ = false;
+    double max_x_ = 0;
+    double min_x_ = 0;
+    double max_y_ = 0;
+    double min_y_ = 0;
+
+    CompensatedSum area_;
+    CompensatedSum Qx_;         /**< First moment about the origin's x axis */
+    CompensatedSum Qy_;         /**< First moment about the origin's y axis */
+    CompensatedSum Qz_;
+    CompensatedSum Ixx_;        /**< Second moments about the origin */
+    CompensatedSum Iyy_;
+    CompensatedSum Ixy_;
+  };
+
+};  // namespace eng
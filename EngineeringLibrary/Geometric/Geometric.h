@@ -13,3 +13,13 @@
 // Rectangles
 #include "Rectangle.h"
 #include "HollowRectangle.h"
+
+// Composite sections
+#include "CompositeSection.h"
+#include "ThinWalledSection.h"
+
+// Standard sections
+#include "SteelSection.h"
+
+// Section design
+#include "SectionOptimizer.h"
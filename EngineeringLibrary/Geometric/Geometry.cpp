@@ -1,16 +1,50 @@
 #include "pch.h"
 #include "Geometry.h"
 
+#include <cmath>
+#include <algorithm>
+
 namespace eng {
 
+  Extents::Extents(const Length& t, const Length& b, const Length& l, const Length& r) :
+    top(t),
+    bottom(b),
+    left(l),
+    right(r) { }
+
+  TorsionProperties::TorsionProperties(const SecondMomentOfArea& j, const WarpingConstant& cw,
+                                       const LengthVec& sc) :
+    J(j),
+    Cw(cw),
+    shear_center(sc) { }
+
   Geometry::Geometry(const Area & area, 
                      const SecondMomentOfArea & ixx,
                      const SecondMomentOfArea & iyy, 
                      const SecondMomentOfArea & ixy, 
                      const LengthVec & centroid) :
+  centroid_(centroid),
+  area_(area),
+  MOI_(ixx, iyy, ixy),
+  derived_(derive(MOI_, extents_)) { }
+
+  Geometry::Geometry(const Area& area,
+                     const SecondMomentOfArea& ixx,
+                     const SecondMomentOfArea& iyy,
+                     const SecondMomentOfArea& ixy,
+                     const LengthVec& centroid,
+                     const Extents& extents,
+                     const std::optional<FirstMomentOfArea>& zx,
+                     const std::optional<FirstMomentOfArea>& zy,
+                     const std::optional<TorsionProperties>& torsion) :
+  centroid_(centroid),
   area_(area),
   MOI_(ixx, iyy, ixy),
-  centroid_(centroid) { }
+  extents_(extents),
+  Zx_(zx),
+  Zy_(zy),
+  torsion_(torsion),
+  derived_(derive(MOI_, extents_)) { }
 
   LengthVec Geometry::centroid() const {
     return centroid_;
@@ -29,7 +63,17 @@ namespace eng {
   }
 
   SecondMomentOfArea Geometry::Ixx(const Angle& theta) const {
-      return (MOI_.Ixx + MOI_.Iyy)/2 + (MOI_.Ixx - MOI_.Iyy)/2 * cos(2*theta) - MOI_.Ixy * sin(2*theta);
+    const auto& d = derived();
+    return SecondMomentOfArea(d.average + d.radius*std::cos(2*theta.rad() - d.phase));
+  }
+
+  std::vector<SecondMomentOfArea> Geometry::Ixx(const std::vector<Angle>& thetas) const {
+    const auto& d = derived();
+    std::vector<SecondMomentOfArea> ret(thetas.size());
+    for (size_t i = 0; i != thetas.size(); ++i) {
+      ret[i] = SecondMomentOfArea(d.average + d.radius*std::cos(2*thetas[i].rad() - d.phase));
+    }
+    return ret;
   }
 
   SecondMomentOfArea Geometry::Iyy() const {
@@ -41,7 +85,17 @@ namespace eng {
   }
 
   SecondMomentOfArea Geometry::Iyy(const Angle& theta) const {
-    return (MOI_.Ixx + MOI_.Iyy)/2 - (MOI_.Ixx - MOI_.Iyy)/2 * cos(2*theta) + MOI_.Ixy * sin(2*theta);
+    const auto& d = derived();
+    return SecondMomentOfArea(d.average - d.radius*std::cos(2*theta.rad() - d.phase));
+  }
+
+  std::vector<SecondMomentOfArea> Geometry::Iyy(const std::vector<Angle>& thetas) const {
+    const auto& d = derived();
+    std::vector<SecondMomentOfArea> ret(thetas.size());
+    for (size_t i = 0; i != thetas.size(); ++i) {
+      ret[i] = SecondMomentOfArea(d.average - d.radius*std::cos(2*thetas[i].rad() - d.phase));
+    }
+    return ret;
   }
 
   SecondMomentOfArea Geometry::Ixy() const {
@@ -53,9 +107,104 @@ namespace eng {
   }
 
   SecondMomentOfArea Geometry::Ixy(const Angle& theta) const {
-    return (MOI_.Ixx - MOI_.Iyy)/2 * sin(2*theta) + MOI_.Ixy * cos(2*theta);
+    const auto& d = derived();
+    return SecondMomentOfArea(d.radius*std::sin(2*theta.rad() - d.phase));
+  }
+
+  std::vector<SecondMomentOfArea> Geometry::Ixy(const std::vector<Angle>& thetas) const {
+    const auto& d = derived();
+    std::vector<SecondMomentOfArea> ret(thetas.size());
+    for (size_t i = 0; i != thetas.size(); ++i) {
+      ret[i] = SecondMomentOfArea(d.radius*std::sin(2*thetas[i].rad() - d.phase));
+    }
+    return ret;
+  }
+
+  Angle Geometry::principal_angle() const {
+    return Angle(derived().phase/2);
+  }
+
+  SecondMomentOfArea Geometry::I1() const {
+    const auto& d = derived();
+    return SecondMomentOfArea(d.average + d.radius);
   }
 
+  SecondMomentOfArea Geometry::I2() const {
+    const auto& d = derived();
+    return SecondMomentOfArea(d.average - d.radius);
+  }
+
+  std::optional<FirstMomentOfArea> Geometry::Sx() const {
+    return derived().Sx;
+  }
+
+  std::optional<FirstMomentOfArea> Geometry::Sy() const {
+    return derived().Sy;
+  }
+
+  std::optional<SecondMomentOfArea> Geometry::J() const {
+    if (!torsion_) {
+      return std::nullopt;
+    }
+    return torsion_->J;
+  }
+
+  std::optional<WarpingConstant> Geometry::Cw() const {
+    if (!torsion_) {
+      return std::nullopt;
+    }
+    return torsion_->Cw;
+  }
+
+  std::optional<LengthVec> Geometry::shear_center() const {
+    if (!torsion_) {
+      return std::nullopt;
+    }
+    return torsion_->shear_center;
+  }
+
+  Geometry::DerivedProperties Geometry::derive(const AreaMomentofInertia& moi,
+                                              const std::optional<Extents>& extents) {
+    const double half_difference = (moi.Ixx - moi.Iyy).value()/2;
+    DerivedProperties d;
+    d.average = (moi.Ixx + moi.Iyy).value()/2;
+    d.radius = std::hypot(half_difference, moi.Ixy.value());
+    d.phase = std::atan2(-moi.Ixy.value(), half_difference);
+    if (extents) {
+      d.Sx = moi.Ixx / std::max(extents->top, extents->bottom);
+      d.Sy = moi.Iyy / std::max(extents->left, extents->right);
+    }
+    return d;
+  }
+
+  namespace {
+    /* Combine the bounds of two geometries about a new centroid. The bounds
+     *   of the result are unknown if either of the inputs is unknown. */
+    std::optional<Extents> combine_extents(const std::optional<Extents>& lh, const LengthVec& lh_c,
+                                           const std::optional<Extents>& rh, const LengthVec& rh_c,
+                                           const LengthVec& c) {
+      if (!lh || !rh) {
+        return std::nullopt;
+      }
+      return Extents(std::max(lh_c.y() + lh->top, rh_c.y() + rh->top) - c.y(),
+                     c.y() - std::min(lh_c.y() - lh->bottom, rh_c.y() - rh->bottom),
+                     c.x() - std::min(lh_c.x() - lh->left, rh_c.x() - rh->left),
+                     std::max(lh_c.x() + lh->right, rh_c.x() + rh->right) - c.x());
+    }
+
+    /* Re-reference the bounds of a geometry to a new centroid */
+    std::optional<Extents> shift_extents(const std::optional<Extents>& e, const LengthVec& from,
+                                         const LengthVec& to) {
+      if (!e) {
+        return std::nullopt;
+      }
+      return Extents(e->top + (from.y() - to.y()),
+                     e->bottom - (from.y() - to.y()),
+                     e->left - (from.x() - to.x()),
+                     e->right + (from.x() - to.x()));
+    }
+  };
+
   Geometry eng::operator+(const Geometry& lh, const Geometry& rh) {
     Area composite_area = lh.area_ + rh.area_;
 
@@ -68,7 +217,13 @@ namespace eng {
     auto composite_ixy = rh.Ixy(composite_centroid.x(), composite_centroid.y())
       + lh.Ixy(composite_centroid.x(), composite_centroid.y());
 
-    return Geometry(composite_area, composite_ixx, composite_iyy, composite_ixy, composite_centroid);
+    auto composite_extents = combine_extents(lh.extents_, lh.centroid_,
+                                             rh.extents_, rh.centroid_, composite_centroid);
+    if (!composite_extents) {
+      return Geometry(composite_area, composite_ixx, composite_iyy, composite_ixy, composite_centroid);
+    }
+    return Geometry(composite_area, composite_ixx, composite_iyy, composite_ixy, composite_centroid,
+                    *composite_extents);
   }
 
   Geometry eng::operator-(const Geometry& lh, const Geometry& rh) {
@@ -83,7 +238,13 @@ namespace eng {
     auto composite_ixy = lh.Ixy(composite_centroid.x(), composite_centroid.y())
       - rh.Ixy(composite_centroid.x(), composite_centroid.y());
 
-    return Geometry(composite_area, composite_ixx, composite_iyy, composite_ixy, composite_centroid);
+    // removing material never extends the bounds of the left hand geometry
+    auto composite_extents = shift_extents(lh.extents_, lh.centroid_, composite_centroid);
+    if (!composite_extents) {
+      return Geometry(composite_area, composite_ixx, composite_iyy, composite_ixy, composite_centroid);
+    }
+    return Geometry(composite_area, composite_ixx, composite_iyy, composite_ixy, composite_centroid,
+                    *composite_extents);
   }
 
   Geometry::AreaMomentofInertia::AreaMomentofInertia(const SecondMomentOfArea& xx,
@@ -9,6 +9,9 @@
  * \date   January 2021
  *********************************************************************/
 
+#include <optional>
+#include <vector>
+
 #include "../Units/Angle.h"
 #include "../Units/Length.h"
 #include "../Units/Area.h"
@@ -16,6 +19,51 @@
 
 namespace eng {
 
+  /** The distances from a Geometry's centroid to the edges of its bounding 
+   *    box, which locate the extreme fibers of the section.
+   * \class Extents
+   * \addtogroup Geometric
+   */
+  struct Extents {
+    Length top;
+    Length bottom;
+    Length left;
+    Length right;
+
+    /**
+     * \brief Extents constructor
+     *
+     * \param t The distance from the centroid to the top (+y) edge
+     * \param b The distance from the centroid to the bottom (-y) edge
+     * \param l The distance from the centroid to the left (-x) edge
+     * \param r The distance from the centroid to the right (+x) edge
+     */
+    Extents(const Length& t = 0_m, const Length& b = 0_m,
+            const Length& l = 0_m, const Length& r = 0_m);
+  };
+
+  /** The properties of a section which resist twisting. The shear center 
+   *    is the point through which a transverse load causes no twist.
+   * \class TorsionProperties
+   * \addtogroup Geometric
+   */
+  struct TorsionProperties {
+    SecondMomentOfArea J;
+    WarpingConstant Cw;
+    LengthVec shear_center;
+
+    /**
+     * \brief TorsionProperties constructor
+     *
+     * \param j The Saint-Venant torsion constant
+     * \param cw The warping constant
+     * \param sc The location of the shear center in space
+     */
+    TorsionProperties(const SecondMomentOfArea& j = 0_m4,
+                      const WarpingConstant& cw = WarpingConstant(0),
+                      const LengthVec& sc = {0_m, 0_m, 0_m});
+  };
+
   /** A generic 2D geometry
    * \class Geometry
    * \addtogroup Geometric
@@ -39,6 +87,29 @@ namespace eng {
              const SecondMomentOfArea& iyy = 0_m4,
              const SecondMomentOfArea& ixy = 0_m4,
              const LengthVec& centroid = {0_m, 0_m, 0_m});
+    /**
+     * \brief Geometry constructor for a section with known bounds
+     *
+     * \param area The area of the geometry
+     * \param ixx The area moment of inertia about the geometry's x axis
+     * \param iyy The area moment of inertia about the geometry's y axis
+     * \param ixy The product of inertia of the geometry
+     * \param centroid The location of the geometry's centroid
+     * \param extents The distances from the centroid to the extreme fibers
+     * \param zx The plastic section modulus about the x axis, if known
+     * \param zy The plastic section modulus about the y axis, if known
+     * \param torsion The torsion constant, warping constant and shear center,
+     *   if known
+     */
+    Geometry(const Area& area,
+             const SecondMomentOfArea& ixx,
+             const SecondMomentOfArea& iyy,
+             const SecondMomentOfArea& ixy,
+             const LengthVec& centroid,
+             const Extents& extents,
+             const std::optional<FirstMomentOfArea>& zx = std::nullopt,
+             const std::optional<FirstMomentOfArea>& zy = std::nullopt,
+             const std::optional<TorsionProperties>& torsion = std::nullopt);
 
     /** Returns the centroid of the Geometry.
      */
@@ -66,6 +137,14 @@ namespace eng {
      * \return the area moment of inertia of a shape about axes rotated by theta
      */
     SecondMomentOfArea Ixx(const Angle& theta) const;
+    /**
+     * Calculate the moment of inertia of a shape along many rotated axes.
+     *
+     * \param thetas The angles of rotation to the new axes from the old ones,
+     *   where positive is counterclockwise from the axes.
+     * \return the area moments of inertia about each set of rotated axes
+     */
+    std::vector<SecondMomentOfArea> Ixx(const std::vector<Angle>& thetas) const;
 
     /** Return the YY moment of inertia of a shape about its own centroid.
      */
@@ -85,6 +164,14 @@ namespace eng {
      * \return the area moment of inertia of a shape about axes rotated by theta
      */
     SecondMomentOfArea Iyy(const Angle& theta) const;
+    /**
+     * Calculate the moment of inertia of a shape along many rotated axes.
+     *
+     * \param thetas The angles of rotation to the new axes from the old ones,
+     *   where positive is counterclockwise from the axes.
+     * \return the area moments of inertia about each set of rotated axes
+     */
+    std::vector<SecondMomentOfArea> Iyy(const std::vector<Angle>& thetas) const;
 
     /** Return the product of inertia of a shape about its own centroid.
     */
@@ -107,6 +194,56 @@ namespace eng {
      * \return the product of inertia of a shape about axes rotated by theta
      */
     SecondMomentOfArea Ixy(const Angle& theta) const;
+    /**
+     * Calculate the product of inertia of a shape along many rotated axes.
+     *
+     * \param thetas The angles of rotation to the new axes from the old ones,
+     *   where positive is counterclockwise from the axes.
+     * \return the products of inertia about each set of rotated axes
+     */
+    std::vector<SecondMomentOfArea> Ixy(const std::vector<Angle>& thetas) const;
+
+    /** Return the angle from the geometry's axes to the principal axis of 
+     *    maximum moment of inertia, where positive is counterclockwise.
+     */
+    Angle principal_angle() const;
+    /** Return the maximum principal moment of inertia.
+     */
+    SecondMomentOfArea I1() const;
+    /** Return the minimum principal moment of inertia.
+     */
+    SecondMomentOfArea I2() const;
+
+    /** Return the distances from the centroid to the extreme fibers, if the 
+     *    bounds of the Geometry are known.
+     */
+    std::optional<Extents> extents() const { return extents_; }
+
+    /** Return the elastic section modulus about the x axis at the extreme 
+     *    fiber farthest from the centroid, if the bounds are known.
+     */
+    std::optional<FirstMomentOfArea> Sx() const;
+    /** Return the elastic section modulus about the y axis at the extreme 
+     *    fiber farthest from the centroid, if the bounds are known.
+     */
+    std::optional<FirstMomentOfArea> Sy() const;
+
+    /** Return the plastic section modulus about the x axis, if known.
+     */
+    std::optional<FirstMomentOfArea> Zx() const { return Zx_; }
+    /** Return the plastic section modulus about the y axis, if known.
+     */
+    std::optional<FirstMomentOfArea> Zy() const { return Zy_; }
+
+    /** Return the Saint-Venant torsion constant, if known.
+     */
+    std::optional<SecondMomentOfArea> J() const;
+    /** Return the warping constant, if known.
+     */
+    std::optional<WarpingConstant> Cw() const;
+    /** Return the location of the shear center in space, if known.
+     */
+    std::optional<LengthVec> shear_center() const;
 
   private:
     LengthVec centroid_;        /**< The centroid of this Geometry in space */
@@ -123,6 +260,32 @@ namespace eng {
     } MOI_;   /**< The moment of inertia of this
                                      Geometry about the X and Y axes and 
                                      the XY product of inertia */
+
+    std::optional<Extents> extents_;              /**< The bounds of this Geometry */
+    std::optional<FirstMomentOfArea> Zx_;         /**< Plastic section moduli */
+    std::optional<FirstMomentOfArea> Zy_;
+    std::optional<TorsionProperties> torsion_;    /**< Torsion constants, which are
+                                                       unknown for composites */
+
+    /* Properties derived from the moments of inertia, which are calculated
+     * once on construction so a Geometry can be read from many threads. The
+     * moments of inertia about axes rotated by theta are
+     *   Ixx = average + radius*cos(2*theta - phase)
+     *   Iyy = average - radius*cos(2*theta - phase)
+     *   Ixy = radius*sin(2*theta - phase)
+     */
+    struct DerivedProperties {
+      double average;
+      double radius;
+      double phase;
+      std::optional<FirstMomentOfArea> Sx;
+      std::optional<FirstMomentOfArea> Sy;
+    };
+    DerivedProperties derived_;
+
+    static DerivedProperties derive(const AreaMomentofInertia& moi,
+                                    const std::optional<Extents>& extents);
+    const DerivedProperties& derived() const { return derived_; }
   };
 
   /* Calculate Radius of Gyration of a Moment of Inertia and an Area */
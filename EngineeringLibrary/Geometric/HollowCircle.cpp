@@ -8,10 +8,14 @@ namespace eng {
                              const LengthVec& c) :
     outer_diameter_(od),
     inner_diameter_(id),
-    Geometry(pi*((od*od) - (id*id))/4,
-             pi*((od*od*od*od) - (id*id*id*id))/64,
-             pi*((od*od*od*od) - (id*id*id*id))/64,
+    Geometry(area_of(od, id),
+             I_of(od, id),
+             I_of(od, id),
              0_m4,
-             c) { }
+             c,
+             Extents(od/2, od/2, od/2, od/2),
+             ((od*od*od) - (id*id*id))/6,
+             ((od*od*od) - (id*id*id))/6,
+             TorsionProperties(pi*((od*od*od*od) - (id*id*id*id))/32, WarpingConstant(0), c)) { }
 
 };  // namespace eng
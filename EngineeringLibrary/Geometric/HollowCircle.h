@@ -32,6 +32,13 @@ namespace eng {
     Length outer_diameter() const { return outer_diameter_; }
     Length inner_diameter() const { return inner_diameter_; }
 
+    /* The closed forms of the properties, which take Lengths or plain
+     *   values in SI units so batches of candidates can share them */
+    template <typename T>
+    static auto area_of(const T& od, const T& id) { return pi*((od*od) - (id*id))/4; }
+    template <typename T>
+    static auto I_of(const T& od, const T& id) { return pi*((od*od*od*od) - (id*id*id*id))/64; }
+
   private:
     Length outer_diameter_;
     Length inner_diameter_;
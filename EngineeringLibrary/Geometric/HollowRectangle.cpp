@@ -3,6 +3,13 @@
 
 namespace eng {
 
+  namespace {
+    SecondMomentOfArea hollow_rectangle_torsion_constant(const Length& b, const Length& h,
+                                                         const Length& t, const Length& t1) {
+      return 2*t*t1*(b - t)*(b - t)*(h - t1)*(h - t1)/(b*t + h*t1 - t*t - t1*t1);
+    }
+  };
+
   HollowRectangle::HollowRectangle(const Length& ob, const Length& oh, 
                                    const Length& ib, const Length& ih, 
                                    const LengthVec& c) :
@@ -10,12 +17,17 @@ namespace eng {
     outer_height_(oh),
     inner_base_(ib),
     inner_height_(ih),
-    Geometry((ob*oh) - (ib*ih),
-             ((ob*oh*oh*oh) 
-              - (ib*ih*ih*ih))/12,
-             ((ob*ob*ob*oh)
-              - (ib*ib*ib*ih))/12,
+    Geometry(area_of(ob, oh, ib, ih),
+             Ixx_of(ob, oh, ib, ih),
+             Iyy_of(ob, oh, ib, ih),
              0_m4,
-             c) { }
+             c,
+             Extents(oh/2, oh/2, ob/2, ob/2),
+             ((ob*oh*oh) - (ib*ih*ih))/4,
+             ((ob*ob*oh) - (ib*ib*ih))/4,
+             // Closed thin walls with different side and top thicknesses,
+             //   warping is negligible for a closed section
+             TorsionProperties(hollow_rectangle_torsion_constant(ob, oh, (ob - ib)/2, (oh - ih)/2),
+                               WarpingConstant(0), c)) { }
 
 };  // namespace eng
@@ -37,6 +37,21 @@ namespace eng {
     Length inner_base() const { return inner_base_; }
     Length inner_height() const { return inner_height_; }
 
+    /* The closed forms of the properties, which take Lengths or plain
+     *   values in SI units so batches of candidates can share them */
+    template <typename T>
+    static auto area_of(const T& ob, const T& oh, const T& ib, const T& ih) {
+      return (ob*oh) - (ib*ih);
+    }
+    template <typename T>
+    static auto Ixx_of(const T& ob, const T& oh, const T& ib, const T& ih) {
+      return ((ob*oh*oh*oh) - (ib*ih*ih*ih))/12;
+    }
+    template <typename T>
+    static auto Iyy_of(const T& ob, const T& oh, const T& ib, const T& ih) {
+      return ((ob*ob*ob*oh) - (ib*ib*ib*ih))/12;
+    }
+
   private:
     Length outer_base_;
     Length outer_height_;
@@ -1,17 +1,34 @@
 #include "pch.h"
 #include "Rectangle.h"
 
+#include <algorithm>
+
 namespace eng {
 
+  namespace {
+    SecondMomentOfArea rectangle_torsion_constant(const Length& b, const Length& h) {
+      const Length a = std::max(b, h)/2;
+      const Length t = std::min(b, h)/2;
+      const double r = t/a;
+      return a*t*t*t*(16.0/3 - 3.36*r*(1 - r*r*r*r/12));
+    }
+  };
+
   Rectangle::Rectangle(const Length& b, 
                        const Length& h, 
                        const LengthVec& c) :
     base_(b),
     height_(h),
-    Geometry(b*h,
-             b*h*h*h/12,
-             b*b*b*h/12,
+    Geometry(area_of(b, h),
+             Ixx_of(b, h),
+             Iyy_of(b, h),
              0_m4,
-             c) { }
+             c,
+             Extents(h/2, h/2, b/2, b/2),
+             b*h*h/4,
+             b*b*h/4,
+             // Roark's approximation for the torsion constant, warping is 
+             //   negligible for a solid rectangle
+             TorsionProperties(rectangle_torsion_constant(b, h), WarpingConstant(0), c)) { }
 
 };  // namespace eng
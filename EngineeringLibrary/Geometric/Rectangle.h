@@ -32,6 +32,15 @@ namespace eng {
     Length base() const { return base_; }
     Length height() const { return height_; }
 
+    /* The closed forms of the properties, which take Lengths or plain
+     *   values in SI units so batches of candidates can share them */
+    template <typename T>
+    static auto area_of(const T& b, const T& h) { return b*h; }
+    template <typename T>
+    static auto Ixx_of(const T& b, const T& h) { return b*h*h*h/12; }
+    template <typename T>
+    static auto Iyy_of(const T& b, const T& h) { return b*b*b*h/12; }
+
   private:
     Length base_;
     Length height_;
@@ -0,0 +1,209 @@
+#include "pch.h"
+#include "SectionOptimizer.h"
+
+#include <cmath>
+#include <algorithm>
+
+#include "Rectangle.h"
+#include "HollowRectangle.h"
+#include "HollowCircle.h"
+
+namespace eng {
+
+  namespace {
+    /* Candidates are evaluated in fixed size batches so the memory used by a
+     *   search does not grow with the grid. */
+    constexpr std::size_t batch_size = 4096;
+  };
+
+  Geometry SectionOptimizer::Design::geometry(const LengthVec& c) const {
+    switch (shape) {
+    case Shape::HOLLOW_RECTANGLE:
+      return HollowRectangle(base, height, base - 2*thickness, height - 2*thickness, c);
+    case Shape::HOLLOW_CIRCLE:
+      return HollowCircle(base, base - 2*thickness, c);
+    default:
+      return Rectangle(base, height, c);
+    }
+  }
+
+  void SectionOptimizer::Batch::resize(const std::size_t& n) {
+    base.resize(n);
+    height.resize(n);
+    thickness.resize(n);
+    area.resize(n);
+    Ixx.resize(n);
+    Iyy.resize(n);
+    Sx.resize(n);
+    r.resize(n);
+  }
+
+  SectionOptimizer::SectionOptimizer(const Shape& shape) :
+    shape_(shape),
+    ranges_{{0, 0}, {0, 0}, {0, 0}} { }
+
+  SectionOptimizer& SectionOptimizer::base(const Length& min, const Length& max) {
+    ranges_[0] = {min.value(), max.value()};
+    return *this;
+  }
+
+  SectionOptimizer& SectionOptimizer::height(const Length& min, const Length& max) {
+    ranges_[1] = {min.value(), max.value()};
+    return *this;
+  }
+
+  SectionOptimizer& SectionOptimizer::thickness(const Length& min, const Length& max) {
+    ranges_[2] = {min.value(), max.value()};
+    return *this;
+  }
+
+  SectionOptimizer& SectionOptimizer::require_Ixx(const SecondMomentOfArea& I) {
+    min_Ixx_ = I.value();
+    return *this;
+  }
+
+  SectionOptimizer& SectionOptimizer::require_Iyy(const SecondMomentOfArea& I) {
+    min_Iyy_ = I.value();
+    return *this;
+  }
+
+  SectionOptimizer& SectionOptimizer::require_Sx(const FirstMomentOfArea& S) {
+    min_Sx_ = S.value();
+    return *this;
+  }
+
+  SectionOptimizer& SectionOptimizer::require_radius_of_gyration(const Length& r) {
+    min_r_ = r.value();
+    return *this;
+  }
+
+  SectionOptimizer& SectionOptimizer::resolution(const std::size_t& points,
+                                                 const std::size_t& refinements) {
+    points_ = std::max(points, std::size_t(2));
+    refinements_ = refinements;
+    return *this;
+  }
+
+  void SectionOptimizer::evaluate(Batch& batch) const {
+    const std::size_t n = batch.size();
+    batch.resize(n);
+    const double* b = batch.base.data();
+    const double* h = batch.height.data();
+    const double* t = batch.thickness.data();
+    double* A = batch.area.data();
+    double* Ixx = batch.Ixx.data();
+    double* Iyy = batch.Iyy.data();
+    double* Sx = batch.Sx.data();
+
+    // One branch for the shape, then straight loops over the arrays with
+    //   the closed forms of the shapes themselves
+    switch (shape_) {
+    case Shape::RECTANGLE:
+      for (std::size_t i = 0; i < n; ++i) {
+        A[i] = Rectangle::area_of(b[i], h[i]);
+        Ixx[i] = Rectangle::Ixx_of(b[i], h[i]);
+        Iyy[i] = Rectangle::Iyy_of(b[i], h[i]);
+        Sx[i] = b[i]*h[i]*h[i]/6;
+      }
+      break;
+    case Shape::HOLLOW_RECTANGLE:
+      for (std::size_t i = 0; i < n; ++i) {
+        const double ib = b[i] - 2*t[i];
+        const double ih = h[i] - 2*t[i];
+        const double valid = (ib >= 0 && ih >= 0) ? 1.0 : 0.0;
+        A[i] = valid*HollowRectangle::area_of(b[i], h[i], ib, ih);
+        Ixx[i] = valid*HollowRectangle::Ixx_of(b[i], h[i], ib, ih);
+        Iyy[i] = valid*HollowRectangle::Iyy_of(b[i], h[i], ib, ih);
+        Sx[i] = h[i] > 0 ? 2*Ixx[i]/h[i] : 0;
+      }
+      break;
+    case Shape::HOLLOW_CIRCLE:
+      for (std::size_t i = 0; i < n; ++i) {
+        const double od = b[i];
+        const double id = b[i] - 2*t[i];
+        const double valid = id >= 0 ? 1.0 : 0.0;
+        A[i] = valid*HollowCircle::area_of(od, id);
+        Ixx[i] = valid*HollowCircle::I_of(od, id);
+        Iyy[i] = Ixx[i];
+        Sx[i] = od > 0 ? 2*Ixx[i]/od : 0;
+      }
+      break;
+    }
+
+    double* r = batch.r.data();
+    for (std::size_t i = 0; i < n; ++i) {
+      r[i] = A[i] > 0 ? std::sqrt(std::min(Ixx[i], Iyy[i])/A[i]) : 0;
+    }
+  }
+
+  bool SectionOptimizer::feasible(const Batch& batch, const std::size_t& i) const {
+    return batch.area[i] > 0
+      && batch.Ixx[i] >= min_Ixx_
+      && batch.Iyy[i] >= min_Iyy_
+      && batch.Sx[i] >= min_Sx_
+      && batch.r[i] >= min_r_;
+  }
+
+  bool SectionOptimizer::search(const Range (&ranges)[3], Batch& batch,
+                                double (&best)[3], double& best_area) const {
+    // Dimensions which the shape does not use, or which are fixed, get one point
+    const bool used[3] = {true, shape_ != Shape::HOLLOW_CIRCLE, shape_ != Shape::RECTANGLE};
+    std::size_t n[3];
+    double step[3];
+    for (int d = 0; d != 3; ++d) {
+      n[d] = (used[d] && ranges[d].max > ranges[d].min) ? points_ : 1;
+      step[d] = n[d] > 1 ? (ranges[d].max - ranges[d].min)/(n[d] - 1) : 0;
+    }
+
+    bool found = false;
+    const std::size_t total = n[0]*n[1]*n[2];
+    for (std::size_t first = 0; first < total; first += batch_size) {
+      const std::size_t count = std::min(batch_size, total - first);
+      batch.resize(count);
+      for (std::size_t k = 0; k != count; ++k) {
+        const std::size_t index = first + k;
+        batch.base[k] = ranges[0].min + step[0]*(index % n[0]);
+        batch.height[k] = ranges[1].min + step[1]*((index / n[0]) % n[1]);
+        batch.thickness[k] = ranges[2].min + step[2]*(index / (n[0]*n[1]));
+      }
+      evaluate(batch);
+
+      for (std::size_t k = 0; k != count; ++k) {
+        if (batch.area[k] < best_area && feasible(batch, k)) {
+          best_area = batch.area[k];
+          best[0] = batch.base[k];
+          best[1] = batch.height[k];
+          best[2] = batch.thickness[k];
+          found = true;
+        }
+      }
+    }
+    return found;
+  }
+
+  std::optional<SectionOptimizer::Design> SectionOptimizer::optimize() const {
+    Batch batch;
+    double best[3] = {0, 0, 0};
+    double best_area = HUGE_VAL;
+
+    Range ranges[3] = {ranges_[0], ranges_[1], ranges_[2]};
+    if (!search(ranges, batch, best, best_area)) {
+      return std::nullopt;
+    }
+
+    // Zoom in on the best candidate, keeping two grid steps either side
+    for (std::size_t pass = 0; pass != refinements_; ++pass) {
+      for (int d = 0; d != 3; ++d) {
+        const double span = 2*(ranges[d].max - ranges[d].min)/(points_ - 1);
+        ranges[d] = {std::max(ranges_[d].min, best[d] - span),
+                     std::min(ranges_[d].max, best[d] + span)};
+      }
+      search(ranges, batch, best, best_area);
+    }
+
+    const Length b(best[0]);
+    return Design{shape_, b, shape_ == Shape::HOLLOW_CIRCLE ? b : Length(best[1]),
+                  shape_ == Shape::RECTANGLE ? 0_m : Length(best[2])};
+  }
+
+};  // namespace eng
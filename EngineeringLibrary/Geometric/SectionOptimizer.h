@@ -0,0 +1,149 @@
+#pragma once
+
+/*****************************************************************//**
+ * \file   SectionOptimizer.h
+ * \brief  A search for the lightest parametric section which meets
+ *           stiffness and strength requirements
+ *
+ *
+ * \author bltan
+ * \date   October 2026
+ *********************************************************************/
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "Geometry.h"
+
+namespace eng {
+
+  /** Searches the dimensions of a Rectangle, HollowRectangle or HollowCircle
+   *    for the section of least area which meets a set of requirements.
+   *    Candidates are evaluated in batches of plain arrays with the same
+   *    closed forms as the shapes themselves, so no Geometry is built until
+   *    the best design is found.
+   *
+   *  The search evaluates a grid over the allowed dimensions, then repeatedly
+   *    evaluates a finer grid around the best feasible candidate.
+   * \class SectionOptimizer
+   * \addtogroup Geometric
+   */
+  class SectionOptimizer {
+  public:
+    enum class Shape : unsigned char {
+      RECTANGLE,          /**< Solid rectangle of base and height */
+      HOLLOW_RECTANGLE,   /**< Rectangular tube of base, height and wall thickness */
+      HOLLOW_CIRCLE,      /**< Round tube of outer diameter and wall thickness */
+    };
+
+    /** A candidate section. For a HollowCircle the base is the outer
+     *    diameter and the height is equal to it, and a Rectangle has no wall
+     *    thickness.
+     */
+    struct Design {
+      Shape shape;
+      Length base;
+      Length height;
+      Length thickness;
+
+      /**
+       * \brief Build the Geometry of this design
+       *
+       * \param c The location of the centroid
+       * \return The Rectangle, HollowRectangle or HollowCircle as a Geometry
+       */
+      Geometry geometry(const LengthVec& c = {0_m, 0_m, 0_m}) const;
+    };
+
+    /** A batch of candidates and their properties as parallel arrays in SI
+     *    units. The dimensions are filled in by the caller, and the
+     *    properties by evaluate().
+     */
+    struct Batch {
+      std::vector<double> base;
+      std::vector<double> height;
+      std::vector<double> thickness;
+
+      std::vector<double> area;
+      std::vector<double> Ixx;
+      std::vector<double> Iyy;
+      std::vector<double> Sx;
+      std::vector<double> r;      /**< The least radius of gyration */
+
+      std::size_t size() const { return base.size(); }
+      void resize(const std::size_t& n);
+    };
+
+    /**
+     * \brief SectionOptimizer constructor
+     *
+     * \param shape The shape of section to search
+     */
+    SectionOptimizer(const Shape& shape);
+
+    /** Set the allowed range of the base, or of the outer diameter. */
+    SectionOptimizer& base(const Length& min, const Length& max);
+    /** Set the allowed range of the height, which is ignored for a HollowCircle. */
+    SectionOptimizer& height(const Length& min, const Length& max);
+    /** Set the allowed range of the wall thickness, which is ignored for a Rectangle. */
+    SectionOptimizer& thickness(const Length& min, const Length& max);
+
+    /** Require a minimum moment of inertia about the x axis. */
+    SectionOptimizer& require_Ixx(const SecondMomentOfArea& I);
+    /** Require a minimum moment of inertia about the y axis. */
+    SectionOptimizer& require_Iyy(const SecondMomentOfArea& I);
+    /** Require a minimum elastic section modulus about the x axis, such as
+     *    the bending moment divided by the allowable stress. */
+    SectionOptimizer& require_Sx(const FirstMomentOfArea& S);
+    /** Require a minimum radius of gyration about both axes. */
+    SectionOptimizer& require_radius_of_gyration(const Length& r);
+
+    /**
+     * \brief Set the effort of the search
+     *
+     * \param points The number of grid points along each dimension
+     * \param refinements The number of finer grids searched around the best
+     *   candidate
+     */
+    SectionOptimizer& resolution(const std::size_t& points, const std::size_t& refinements);
+
+    /**
+     * \brief Calculate the properties of a batch of candidates of this shape.
+     *   Candidates with impossible dimensions get zero properties.
+     *
+     * \param batch The candidates, whose properties are overwritten
+     */
+    void evaluate(Batch& batch) const;
+
+    /**
+     * \brief Search for the lightest section which meets all requirements
+     *
+     * \return The best design, or nothing if no candidate is feasible
+     */
+    std::optional<Design> optimize() const;
+
+  private:
+    struct Range {
+      double min;
+      double max;
+    };
+
+    /* Search a grid around the given ranges and update the best candidate,
+     *   returns true if a feasible candidate was found. */
+    bool search(const Range (&ranges)[3], Batch& batch, double (&best)[3], double& best_area) const;
+    bool feasible(const Batch& batch, const std::size_t& i) const;
+
+    Shape shape_;
+    Range ranges_[3];           /**< base, height and thickness */
+
+    double min_Ixx_ = 0;
+    double min_Iyy_ = 0;
+    double min_Sx_ = 0;
+    double min_r_ = 0;
+
+    std::size_t points_ = 48;
+    std::size_t refinements_ = 12;
+  };
+
+};  // namespace eng
@@ -9,6 +9,17 @@ namespace eng {
              (pi/8 - 8/(9*pi))*(d*d*d*d)/16,
              (pi/8)*(d*d*d*d)/16,
              0_m4, 
-             c) { }
+             c,
+             // The flat edge is along the bottom of the SemiCircle, and the 
+             //   plastic neutral axis is 0.40397r above it
+             Extents(d/2 - 2*d/(3*pi), 2*d/(3*pi), d/2, d/2),
+             0.044247648*(d*d*d),
+             (d*d*d)/12,
+             // Saint-Venant's exact torsion constant is (pi/2 - 4/pi)r^4. The
+             //   shear center is 8r/(5pi) above the flat edge and the warping
+             //   constant is 0.0059200r^6, from the warping function.
+             TorsionProperties((pi/2 - 4/pi)*(d*d*d*d)/16,
+                               9.25006e-5*(d*d*d*d*d*d),
+                               c + LengthVec(0_m, 2*d/(15*pi), 0_m))) { }
 
 };
@@ -13,7 +13,7 @@
 
 namespace eng {
   
-  /** A semi circle
+  /** A semi circle with its flat edge along the bottom (-y) of the shape
    * \class SemiCircle
    * \addtogroup Geometric
    */
@@ -0,0 +1,325 @@
+#include "pch.h"
+#include "SteelSection.h"
+#include "../Designation.h"
+
+#include <array>
+#include <cstdint>
+
+namespace eng {
+
+  Geometry SteelSection::geometry(const LengthVec& c) const {
+    return Geometry(area(), Ixx(), Iyy(), Ixy(), c,
+                    Extents(Length(properties_.top), Length(properties_.bottom),
+                            Length(properties_.left), Length(properties_.right)),
+                    Zx(), Zy(),
+                    TorsionProperties(J(), Cw(), c + LengthVec(Length(properties_.xs),
+                                                               Length(properties_.ys), 0_m)));
+  }
+
+  namespace {
+
+    constexpr double in = 0.0254;
+    constexpr double mm = 0.001;
+
+    /* A rectangular plate between the corners (x0, y0) and (x1, y1) */
+    struct Plate {
+      double x0, y0, x1, y1;
+    };
+
+    /* An idealized section made of up to four non-overlapping plates */
+    struct Plates {
+      std::array<Plate, 4> plates;
+      int count;
+    };
+
+    constexpr double clamp(const double& x, const double& lo, const double& hi) {
+      return x < lo ? lo : (x > hi ? hi : x);
+    }
+
+    /* Calculate the plastic section modulus about an axis along the first
+     *   coordinate, where lo and hi select the coordinates of each plate
+     *   across the axis. The area on either side of the plastic neutral axis
+     *   is piecewise linear in its position, so the axis is found exactly by
+     *   searching the plate edges. */
+    constexpr double plastic_modulus(const Plates& p, double Plate::* lo, double Plate::* hi,
+                                     double Plate::* w_lo, double Plate::* w_hi) {
+      std::array<double, 8> edges{};
+      int n = 0;
+      double total = 0;
+      for (int i = 0; i != p.count; ++i) {
+        edges[n++] = p.plates[i].*lo;
+        edges[n++] = p.plates[i].*hi;
+        total += (p.plates[i].*hi - p.plates[i].*lo) * (p.plates[i].*w_hi - p.plates[i].*w_lo);
+      }
+      // insertion sort the plate edges
+      for (int i = 1; i < n; ++i) {
+        for (int j = i; j > 0 && edges[j - 1] > edges[j]; --j) {
+          double t = edges[j];
+          edges[j] = edges[j - 1];
+          edges[j - 1] = t;
+        }
+      }
+
+      auto area_below = [&p, lo, hi, w_lo, w_hi](const double& y) {
+        double a = 0;
+        for (int i = 0; i != p.count; ++i) {
+          a += (clamp(y, p.plates[i].*lo, p.plates[i].*hi) - p.plates[i].*lo)
+            * (p.plates[i].*w_hi - p.plates[i].*w_lo);
+        }
+        return a;
+      };
+
+      double pna = edges[0];
+      for (int i = 1; i < n; ++i) {
+        const double a0 = area_below(edges[i - 1]);
+        const double a1 = area_below(edges[i]);
+        if (a1 >= total/2 && a1 > a0) {
+          pna = edges[i - 1] + (total/2 - a0)/(a1 - a0) * (edges[i] - edges[i - 1]);
+          break;
+        }
+      }
+
+      double Z = 0;
+      for (int i = 0; i != p.count; ++i) {
+        const double y0 = p.plates[i].*lo, y1 = p.plates[i].*hi;
+        const double w = p.plates[i].*w_hi - p.plates[i].*w_lo;
+        // first moments of the parts of the plate below and above the axis
+        const double far_below = pna - y0, near_below = pna - clamp(pna, y0, y1);
+        const double far_above = y1 - pna, near_above = clamp(pna, y0, y1) - pna;
+        Z += w * ((far_below > 0 ? far_below*far_below - near_below*near_below : 0)
+                  + (far_above > 0 ? far_above*far_above - near_above*near_above : 0)) / 2;
+      }
+      return Z;
+    }
+
+    /* Calculate the properties of an idealized section of plates, with the
+     *   torsion constant, warping constant and shear center (xs, ys) given 
+     *   separately from thin-walled theory */
+    constexpr SteelSection::Properties plate_properties(const Plates& p, const double& J,
+                                                        const double& Cw,
+                                                        const double& xs, const double& ys) {
+      double A = 0, Qx = 0, Qy = 0;
+      double x_min = p.plates[0].x0, x_max = p.plates[0].x1;
+      double y_min = p.plates[0].y0, y_max = p.plates[0].y1;
+      for (int i = 0; i != p.count; ++i) {
+        const Plate& r = p.plates[i];
+        const double a = (r.x1 - r.x0) * (r.y1 - r.y0);
+        A += a;
+        Qx += a * (r.y0 + r.y1)/2;
+        Qy += a * (r.x0 + r.x1)/2;
+        x_min = r.x0 < x_min ? r.x0 : x_min;
+        x_max = r.x1 > x_max ? r.x1 : x_max;
+        y_min = r.y0 < y_min ? r.y0 : y_min;
+        y_max = r.y1 > y_max ? r.y1 : y_max;
+      }
+      const double cx = Qy/A, cy = Qx/A;
+
+      double Ixx = 0, Iyy = 0, Ixy = 0;
+      for (int i = 0; i != p.count; ++i) {
+        const Plate& r = p.plates[i];
+        const double b = r.x1 - r.x0, h = r.y1 - r.y0;
+        const double dx = (r.x0 + r.x1)/2 - cx, dy = (r.y0 + r.y1)/2 - cy;
+        Ixx += b*h*h*h/12 + b*h*dy*dy;
+        Iyy += h*b*b*b/12 + b*h*dx*dx;
+        Ixy += b*h*dx*dy;
+      }
+
+      return {A, Ixx, Iyy, Ixy, J, Cw, xs - cx, ys - cy,
+              plastic_modulus(p, &Plate::y0, &Plate::y1, &Plate::x0, &Plate::x1),
+              plastic_modulus(p, &Plate::x0, &Plate::x1, &Plate::y0, &Plate::y1),
+              y_max - cy, cy - y_min, cx - x_min, x_max - cx};
+    }
+
+    /* The torsion constant of a thin open plate */
+    constexpr double open_J(const double& length, const double& t) {
+      return length*t*t*t/3;
+    }
+
+    constexpr SteelSection wide_flange(const char* name, double d, double b, double tw,
+                                       double tf, double unit) {
+      d *= unit; b *= unit; tw *= unit; tf *= unit;
+      Plates p{{{{-b/2, -d/2, b/2, -d/2 + tf},
+                 {-tw/2, -d/2 + tf, tw/2, d/2 - tf},
+                 {-b/2, d/2 - tf, b/2, d/2}}}, 3};
+      return SteelSection(name, SteelSection::Shape::WIDE_FLANGE, d, b, tw, tf,
+                          plate_properties(p, 2*open_J(b, tf) + open_J(d - tf, tw),
+                                           tf*b*b*b*(d - tf)*(d - tf)/24, 0, 0));
+    }
+
+    constexpr SteelSection channel(const char* name, double d, double b, double tw,
+                                   double tf, double unit) {
+      d *= unit; b *= unit; tw *= unit; tf *= unit;
+      Plates p{{{{0, 0, b, tf},
+                 {0, tf, tw, d - tf},
+                 {0, d - tf, b, d}}}, 3};
+      // the shear center is e0 behind the middle line of the web
+      const double bf = b - tw/2, h0 = d - tf;
+      const double e0 = 3*bf*bf*tf/(6*bf*tf + h0*tw);
+      const double Cw = tf*bf*bf*bf*h0*h0/12 * (3*bf*tf + 2*h0*tw)/(6*bf*tf + h0*tw);
+      return SteelSection(name, SteelSection::Shape::CHANNEL, d, b, tw, tf,
+                          plate_properties(p, 2*open_J(bf, tf) + open_J(h0, tw),
+                                           Cw, tw/2 - e0, d/2));
+    }
+
+    constexpr SteelSection angle(const char* name, double d, double b, double t, double unit) {
+      d *= unit; b *= unit; t *= unit;
+      Plates p{{{{0, 0, b, t},
+                 {0, t, t, d}}}, 2};
+      return SteelSection(name, SteelSection::Shape::ANGLE, d, b, t, t,
+                          plate_properties(p, open_J(b - t/2, t) + open_J(d - t/2, t),
+                                           // the shear center is where the legs meet
+                                           t*t*t*((b - t/2)*(b - t/2)*(b - t/2)
+                                                  + (d - t/2)*(d - t/2)*(d - t/2))/36,
+                                           t/2, t/2));
+    }
+
+    /* Rectangular HSS are specified with their design wall thickness */
+    constexpr SteelSection rectangular_hss(const char* name, double h, double b, double t,
+                                           double unit) {
+      h *= unit; b *= unit; t *= unit;
+      Plates p{{{{0, 0, b, t},
+                 {0, t, t, h - t},
+                 {b - t, t, b, h - t},
+                 {0, h - t, b, h}}}, 4};
+      // Bredt's formula for a thin closed section
+      const double Am = (b - t)*(h - t);
+      const double pm = 2*((b - t) + (h - t));
+      return SteelSection(name, SteelSection::Shape::RECTANGULAR_HSS, h, b, t, t,
+                          plate_properties(p, 4*Am*Am*t/pm, 0, b/2, h/2));
+    }
+
+    /* Pipe is specified with its design wall thickness */
+    constexpr SteelSection pipe(const char* name, double D, double t, double unit) {
+      D *= unit; t *= unit;
+      const double Di = D - 2*t;
+      const double A = pi*(D*D - Di*Di)/4;
+      const double I = pi*(D*D*D*D - Di*Di*Di*Di)/64;
+      const double Z = (D*D*D - Di*Di*Di)/6;
+      return SteelSection(name, SteelSection::Shape::PIPE, D, D, t, t,
+                          {A, I, I, 0, 2*I, 0, 0, 0, Z, Z, D/2, D/2, D/2, D/2});
+    }
+
+    constexpr std::array<SteelSection, 56> catalog = {
+      // AISC W shapes: d, bf, tw, tf
+      wide_flange("W4x13", 4.16, 4.06, 0.280, 0.345, in),
+      wide_flange("W6x9", 5.90, 3.94, 0.170, 0.215, in),
+      wide_flange("W6x15", 5.99, 5.99, 0.230, 0.260, in),
+      wide_flange("W8x10", 7.89, 3.94, 0.170, 0.205, in),
+      wide_flange("W8x18", 8.14, 5.25, 0.230, 0.330, in),
+      wide_flange("W8x31", 8.00, 8.00, 0.285, 0.435, in),
+      wide_flange("W10x12", 9.87, 3.96, 0.190, 0.210, in),
+      wide_flange("W10x22", 10.2, 5.75, 0.240, 0.360, in),
+      wide_flange("W10x49", 10.0, 10.0, 0.340, 0.560, in),
+      wide_flange("W12x26", 12.2, 6.49, 0.230, 0.380, in),
+      wide_flange("W12x50", 12.2, 8.08, 0.370, 0.640, in),
+      wide_flange("W14x22", 13.7, 5.00, 0.230, 0.335, in),
+      wide_flange("W14x90", 14.0, 14.5, 0.440, 0.710, in),
+      wide_flange("W16x26", 15.7, 5.50, 0.250, 0.345, in),
+      wide_flange("W16x31", 15.9, 5.53, 0.275, 0.440, in),
+      wide_flange("W18x35", 17.7, 6.00, 0.300, 0.425, in),
+      wide_flange("W21x44", 20.7, 6.50, 0.350, 0.450, in),
+      wide_flange("W24x55", 23.6, 7.01, 0.395, 0.505, in),
+
+      // AISC C shapes: d, bf, tw, tf
+      channel("C6x8.2", 6.00, 1.92, 0.200, 0.343, in),
+      channel("C8x11.5", 8.00, 2.26, 0.220, 0.390, in),
+      channel("C10x20", 10.0, 2.74, 0.379, 0.436, in),
+      channel("C12x20.7", 12.0, 2.94, 0.282, 0.501, in),
+      channel("C15x33.9", 15.0, 3.40, 0.400, 0.650, in),
+
+      // AISC L shapes: long leg, short leg, t
+      angle("L2x2x1/4", 2.0, 2.0, 0.250, in),
+      angle("L3x3x1/4", 3.0, 3.0, 0.250, in),
+      angle("L3x3x3/8", 3.0, 3.0, 0.375, in),
+      angle("L4x4x1/4", 4.0, 4.0, 0.250, in),
+      angle("L4x4x1/2", 4.0, 4.0, 0.500, in),
+      angle("L4x3x3/8", 4.0, 3.0, 0.375, in),
+      angle("L6x4x1/2", 6.0, 4.0, 0.500, in),
+      angle("L6x6x1/2", 6.0, 6.0, 0.500, in),
+
+      // AISC rectangular HSS: H, B, design t (0.93 times nominal)
+      rectangular_hss("HSS2x2x1/4", 2.0, 2.0, 0.233, in),
+      rectangular_hss("HSS3x3x1/4", 3.0, 3.0, 0.233, in),
+      rectangular_hss("HSS4x4x1/4", 4.0, 4.0, 0.233, in),
+      rectangular_hss("HSS4x4x3/8", 4.0, 4.0, 0.349, in),
+      rectangular_hss("HSS6x4x1/4", 6.0, 4.0, 0.233, in),
+      rectangular_hss("HSS6x6x1/4", 6.0, 6.0, 0.233, in),
+      rectangular_hss("HSS6x6x3/8", 6.0, 6.0, 0.349, in),
+      rectangular_hss("HSS8x4x1/4", 8.0, 4.0, 0.233, in),
+      rectangular_hss("HSS8x8x3/8", 8.0, 8.0, 0.349, in),
+      rectangular_hss("HSS8x8x1/2", 8.0, 8.0, 0.465, in),
+
+      // AISC standard weight pipe: D, design t (0.93 times nominal)
+      pipe("Pipe2STD", 2.375, 0.143, in),
+      pipe("Pipe3STD", 3.500, 0.201, in),
+      pipe("Pipe4STD", 4.500, 0.221, in),
+      pipe("Pipe6STD", 6.625, 0.261, in),
+      pipe("Pipe8STD", 8.625, 0.300, in),
+
+      // European I and H sections: h, b, tw, tf
+      wide_flange("IPE100", 100, 55, 4.1, 5.7, mm),
+      wide_flange("IPE200", 200, 100, 5.6, 8.5, mm),
+      wide_flange("IPE300", 300, 150, 7.1, 10.7, mm),
+      wide_flange("IPE400", 400, 180, 8.6, 13.5, mm),
+      wide_flange("HEA200", 190, 200, 6.5, 10.0, mm),
+      wide_flange("HEA300", 290, 300, 8.5, 14.0, mm),
+      wide_flange("HEB100", 100, 100, 6.0, 10.0, mm),
+      wide_flange("HEB200", 200, 200, 9.0, 15.0, mm),
+      wide_flange("HEB300", 300, 300, 11.0, 19.0, mm),
+      wide_flange("HEB400", 400, 300, 13.5, 24.0, mm),
+    };
+
+    /* An open addressing hash table of indices into the catalog, with at
+     *   least twice as many slots as sections to keep the probes short. */
+    constexpr std::size_t slot_count = 128;
+    constexpr std::uint8_t empty_slot = 0xFF;
+    static_assert(catalog.size() * 2 <= slot_count, "The section table is too full");
+
+    constexpr std::array<std::uint8_t, slot_count> make_slots() {
+      std::array<std::uint8_t, slot_count> slots{};
+      for (auto& s : slots) {
+        s = empty_slot;
+      }
+      for (std::size_t i = 0; i != catalog.size(); ++i) {
+        std::size_t slot = designation::hash(catalog[i].designation()) % slot_count;
+        while (slots[slot] != empty_slot) {
+          slot = (slot + 1) % slot_count;
+        }
+        slots[slot] = static_cast<std::uint8_t>(i);
+      }
+      return slots;
+    }
+
+    constexpr std::array<std::uint8_t, slot_count> slots = make_slots();
+
+  };
+
+  namespace steel_sections {
+
+    const SteelSection* find(std::string_view designation) {
+      std::size_t slot = designation::hash(designation) % slot_count;
+      while (slots[slot] != empty_slot) {
+        const SteelSection& section = catalog[slots[slot]];
+        if (designation::same(section.designation(), designation)) {
+          return &section;
+        }
+        slot = (slot + 1) % slot_count;
+      }
+      return nullptr;
+    }
+
+    std::size_t size() {
+      return catalog.size();
+    }
+
+    const SteelSection* begin() {
+      return catalog.data();
+    }
+
+    const SteelSection* end() {
+      return catalog.data() + catalog.size();
+    }
+
+  };  // namespace steel_sections
+
+};  // namespace eng
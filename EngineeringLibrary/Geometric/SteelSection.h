@@ -0,0 +1,142 @@
+#pragma once
+
+/*****************************************************************//**
+ * \file   SteelSection.h
+ * \brief  A catalog of standard rolled and tubular steel sections
+ *
+ *
+ * \author bltan
+ * \date   October 2026
+ *********************************************************************/
+
+#include <cstddef>
+#include <string_view>
+
+#include "Geometry.h"
+
+namespace eng {
+
+  /** A standard steel section and its precomputed properties. The properties
+   *    are calculated from the nominal plate dimensions, neglecting fillets
+   *    and corner radii. SteelSections are stored in a compile time table, so
+   *    they are only ever accessed by pointer or reference.
+   * \class SteelSection
+   * \addtogroup Geometric
+   */
+  class SteelSection {
+  public:
+    enum class Shape : unsigned char {
+      WIDE_FLANGE,      /**< W, IPE, HEA and HEB shapes */
+      CHANNEL,          /**< C shapes, with the flanges pointing in +x */
+      ANGLE,            /**< L shapes, with the legs along the -x and -y edges */
+      RECTANGULAR_HSS,  /**< Rectangular and square hollow structural sections */
+      PIPE,             /**< Round pipe */
+    };
+
+    /* The precomputed properties of a section in SI units. The extents are
+     * the distances from the centroid to the extreme fibers, and xs and ys
+     * locate the shear center relative to the centroid. */
+    struct Properties {
+      double area;
+      double Ixx;
+      double Iyy;
+      double Ixy;
+      double J;
+      double Cw;
+      double xs;
+      double ys;
+      double Zx;
+      double Zy;
+      double top;
+      double bottom;
+      double left;
+      double right;
+    };
+
+    /**
+     * \brief SteelSection constructor, which is used to build the catalog
+     *
+     * \param designation The standard designation of the section
+     * \param shape The shape of the section
+     * \param d The depth of the section, the length of the long leg of an
+     *   angle, or the outer diameter of a pipe, in meters
+     * \param b The width of the flange, the length of the short leg of an
+     *   angle, or the outer diameter of a pipe, in meters
+     * \param tw The thickness of the web or wall, in meters
+     * \param tf The thickness of the flange or wall, in meters
+     * \param properties The precomputed properties of the section
+     */
+    constexpr SteelSection(const char* designation, Shape shape,
+                           double d, double b, double tw, double tf,
+                           const Properties& properties) :
+      designation_(),
+      shape_(shape),
+      depth_(d),
+      width_(b),
+      web_thickness_(tw),
+      flange_thickness_(tf),
+      properties_(properties) {
+      for (std::size_t i = 0; i != sizeof(designation_) - 1 && designation[i] != '\0'; ++i) {
+        designation_[i] = designation[i];
+      }
+    }
+
+    constexpr std::string_view designation() const { return designation_; }
+    Shape shape() const { return shape_; }
+
+    Length depth() const { return Length(depth_); }
+    Length width() const { return Length(width_); }
+    Length web_thickness() const { return Length(web_thickness_); }
+    Length flange_thickness() const { return Length(flange_thickness_); }
+
+    Area area() const { return Area(properties_.area); }
+    SecondMomentOfArea Ixx() const { return SecondMomentOfArea(properties_.Ixx); }
+    SecondMomentOfArea Iyy() const { return SecondMomentOfArea(properties_.Iyy); }
+    SecondMomentOfArea Ixy() const { return SecondMomentOfArea(properties_.Ixy); }
+    /** Returns the torsion constant of the section */
+    SecondMomentOfArea J() const { return SecondMomentOfArea(properties_.J); }
+    /** Returns the warping constant of the section */
+    WarpingConstant Cw() const { return WarpingConstant(properties_.Cw); }
+    FirstMomentOfArea Zx() const { return FirstMomentOfArea(properties_.Zx); }
+    FirstMomentOfArea Zy() const { return FirstMomentOfArea(properties_.Zy); }
+
+    /**
+     * \brief Create a Geometry with the properties of this section
+     *
+     * \param c The location of the centroid of the section
+     * \return The Geometry of this section
+     */
+    Geometry geometry(const LengthVec& c = {0_m, 0_m, 0_m}) const;
+
+  private:
+    char designation_[16];
+    Shape shape_;
+    double depth_;
+    double width_;
+    double web_thickness_;
+    double flange_thickness_;
+    Properties properties_;
+  };
+
+  namespace steel_sections {
+
+    /**
+     * \brief Find a section by its designation. Letter case and spaces are
+     *   ignored, so "W8x31", "w8X31" and "IPE 200" are all found.
+     *
+     * \param designation The designation of the section, such as "W8x31",
+     *   "HSS6x6x1/4" or "IPE200"
+     * \return A pointer to the section, or nullptr if it is not in the catalog
+     */
+    const SteelSection* find(std::string_view designation);
+
+    /** Returns the number of sections in the catalog. */
+    std::size_t size();
+    /** Returns a pointer to the first section in the catalog. */
+    const SteelSection* begin();
+    /** Returns a pointer past the last section in the catalog. */
+    const SteelSection* end();
+
+  };  // namespace steel_sections
+
+};  // namespace eng
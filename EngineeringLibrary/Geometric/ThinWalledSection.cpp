@@ -0,0 +1,288 @@
+#include "pch.h"
+#include "ThinWalledSection.h"
+
+#include <cmath>
+#include <algorithm>
+
+#include <eigen3/Eigen/Dense>
+
+namespace eng {
+
+  std::size_t ThinWalledSection::add_node(const Length& x, const Length& y) {
+    x_.push_back(x.value());
+    y_.push_back(y.value());
+    // a node on its own changes no connections, so the walk still holds
+    return x_.size() - 1;
+  }
+
+  std::optional<std::size_t> ThinWalledSection::add_segment(const std::size_t& start,
+                                                            const std::size_t& end,
+                                                            const Length& t) {
+    if (start >= x_.size() || end >= x_.size() || start == end || !(t.value() > 0)) {
+      return std::nullopt;
+    }
+    segments_.push_back({start, end, t.value()});
+    walk();
+    return segments_.size() - 1;
+  }
+
+  bool ThinWalledSection::move_node(const std::size_t& node, const Length& x, const Length& y) {
+    if (node >= x_.size()) {
+      return false;
+    }
+    x_[node] = x.value();
+    y_[node] = y.value();
+    return true;
+  }
+
+  bool ThinWalledSection::set_thickness(const std::size_t& segment, const Length& t) {
+    if (segment >= segments_.size() || !(t.value() > 0)) {
+      return false;
+    }
+    segments_[segment].t = t.value();
+    return true;
+  }
+
+  bool ThinWalledSection::is_connected() const {
+    return connected_;
+  }
+
+  bool ThinWalledSection::is_open() const {
+    return connected_ && cells_.empty();
+  }
+
+  std::size_t ThinWalledSection::cells() const {
+    return cells_.size();
+  }
+
+  void ThinWalledSection::walk() {
+    steps_.clear();
+    cells_.clear();
+    if (segments_.empty()) {
+      connected_ = false;
+      return;
+    }
+
+    std::vector<std::vector<std::size_t>> connected(x_.size());
+    for (std::size_t i = 0; i != segments_.size(); ++i) {
+      connected[segments_[i].start].push_back(i);
+      connected[segments_[i].end].push_back(i);
+    }
+
+    // Walk breadth first from the start of the first segment. A segment
+    //   between two nodes which have both been reached closes a cell, and a
+    //   segment which is never reached is not connected to the rest.
+    constexpr std::size_t none = static_cast<std::size_t>(-1);
+    std::vector<std::size_t> reached_by(x_.size(), none);     // the step to each node
+    std::vector<std::size_t> depth(x_.size(), 0);
+    std::vector<bool> reached(x_.size(), false);
+    std::vector<bool> used(segments_.size(), false);
+    std::vector<Step> closures;
+    std::vector<std::size_t> queue{segments_[0].start};
+    reached[segments_[0].start] = true;
+    for (std::size_t q = 0; q != queue.size(); ++q) {
+      const std::size_t from = queue[q];
+      for (const auto& s : connected[from]) {
+        if (used[s]) {
+          continue;
+        }
+        used[s] = true;
+        const std::size_t to = segments_[s].start == from ? segments_[s].end : segments_[s].start;
+        if (reached[to]) {
+          closures.push_back({s, from, to});
+          continue;
+        }
+        reached[to] = true;
+        reached_by[to] = steps_.size();
+        depth[to] = depth[from] + 1;
+        queue.push_back(to);
+        steps_.push_back({s, from, to});
+      }
+    }
+    connected_ = steps_.size() + closures.size() == segments_.size();
+
+    // Each closing segment makes a cell with the walked paths from both of
+    //   its nodes back to where they meet. The cell is walked across the
+    //   closing segment, up the path from its far node and down the path to
+    //   its near node.
+    for (const auto& closure : closures) {
+      std::vector<Wall> up{{closure.segment, segments_[closure.segment].start == closure.from}};
+      std::vector<Wall> down;
+      std::size_t u = closure.to, d = closure.from;
+      while (u != d) {
+        if (depth[u] >= depth[d]) {
+          const Step& step = steps_[reached_by[u]];
+          up.push_back({step.segment, segments_[step.segment].start == step.to});
+          u = step.from;
+        }
+        else {
+          const Step& step = steps_[reached_by[d]];
+          down.push_back({step.segment, segments_[step.segment].start == step.from});
+          d = step.from;
+        }
+      }
+      up.insert(up.end(), down.rbegin(), down.rend());
+      cells_.push_back(std::move(up));
+    }
+  }
+
+  Geometry ThinWalledSection::geometry() const {
+    if (segments_.empty()) {
+      return Geometry();
+    }
+
+    // Integrate about the first node to limit cancellation
+    const double x0 = x_[segments_[0].start];
+    const double y0 = y_[segments_[0].start];
+
+    double A = 0, Qx = 0, Qy = 0;
+    // the first node is inside the bounds, so they start from it
+    double min_x = 0, max_x = 0, min_y = 0, max_y = 0;
+    for (const auto& s : segments_) {
+      const double xi = x_[s.start] - x0, yi = y_[s.start] - y0;
+      const double xj = x_[s.end] - x0, yj = y_[s.end] - y0;
+      const double L = std::hypot(xj - xi, yj - yi);
+      const double a = s.t*L;
+      A += a;
+      Qx += a*(yi + yj)/2;
+      Qy += a*(xi + xj)/2;
+
+      // the corners of the wall are half the thickness off the middle line
+      const double nx = L > 0 ? -(yj - yi)/L*s.t/2 : 0;
+      const double ny = L > 0 ? (xj - xi)/L*s.t/2 : 0;
+      for (const double& x : {xi + nx, xi - nx, xj + nx, xj - nx}) {
+        min_x = std::min(min_x, x);
+        max_x = std::max(max_x, x);
+      }
+      for (const double& y : {yi + ny, yi - ny, yj + ny, yj - ny}) {
+        min_y = std::min(min_y, y);
+        max_y = std::max(max_y, y);
+      }
+    }
+    if (A == 0) {
+      return Geometry();
+    }
+    const double cx = Qy/A, cy = Qx/A;
+
+    // Second moments of the middle line, and of each wall through its thickness
+    double Ixx = 0, Iyy = 0, Ixy = 0;
+    double Ixx_t = 0, Iyy_t = 0, Ixy_t = 0;
+    for (const auto& s : segments_) {
+      const double xi = x_[s.start] - x0 - cx, yi = y_[s.start] - y0 - cy;
+      const double xj = x_[s.end] - x0 - cx, yj = y_[s.end] - y0 - cy;
+      const double L = std::hypot(xj - xi, yj - yi);
+      const double a = s.t*L;
+      Ixx += a*(yi*yi + yi*yj + yj*yj)/3;
+      Iyy += a*(xi*xi + xi*xj + xj*xj)/3;
+      Ixy += a*(2*xi*yi + 2*xj*yj + xi*yj + xj*yi)/6;
+      if (L > 0) {
+        const double c = (xj - xi)/L, n = (yj - yi)/L;
+        const double I = L*s.t*s.t*s.t/12;
+        Ixx_t += I*c*c;
+        Iyy_t += I*n*n;
+        Ixy_t -= I*c*n;
+      }
+    }
+
+    const Area area(A);
+    const SecondMomentOfArea ixx(Ixx + Ixx_t);
+    const SecondMomentOfArea iyy(Iyy + Iyy_t);
+    const SecondMomentOfArea ixy(Ixy + Ixy_t);
+    const LengthVec centroid(Length(x0 + cx), Length(y0 + cy), 0_m);
+    const Extents extents(Length(max_y - cy), Length(cy - min_y),
+                          Length(cx - min_x), Length(max_x - cx));
+    if (!connected_) {
+      return Geometry(area, ixx, iyy, ixy, centroid, extents);
+    }
+
+    // The circulating shear flow of each cell for a unit rate of twist, with
+    //   G = 1, makes the twist of every cell the same:
+    //   sum over cells d of q_d*(walls of c and d)(L/t) = 2*(area of cell c)
+    const std::size_t n_cells = cells_.size();
+    std::vector<double> flow(segments_.size(), 0);      // from start to end
+    std::vector<bool> in_cell(segments_.size(), false);
+    double J = 0;
+    if (n_cells != 0) {
+      Eigen::MatrixXd walls = Eigen::MatrixXd::Zero(segments_.size(), n_cells);
+      Eigen::VectorXd enclosed = Eigen::VectorXd::Zero(n_cells);
+      for (std::size_t c = 0; c != n_cells; ++c) {
+        for (const auto& wall : cells_[c]) {
+          const Segment& s = segments_[wall.segment];
+          const std::size_t i = wall.forward ? s.start : s.end;
+          const std::size_t j = wall.forward ? s.end : s.start;
+          const double xi = x_[i] - x0 - cx, yi = y_[i] - y0 - cy;
+          const double xj = x_[j] - x0 - cx, yj = y_[j] - y0 - cy;
+          walls(wall.segment, c) = wall.forward ? 1 : -1;
+          in_cell[wall.segment] = true;
+          enclosed[c] += (xi*yj - xj*yi)/2;
+        }
+      }
+      Eigen::VectorXd flexibility(segments_.size());
+      for (std::size_t i = 0; i != segments_.size(); ++i) {
+        const Segment& s = segments_[i];
+        flexibility[i] = std::hypot(x_[s.end] - x_[s.start], y_[s.end] - y_[s.start])/s.t;
+      }
+      const Eigen::MatrixXd F = walls.transpose()*flexibility.asDiagonal()*walls;
+      const Eigen::VectorXd q = F.ldlt().solve(2*enclosed);
+      const Eigen::VectorXd segment_flow = walls*q;
+      std::copy(segment_flow.data(), segment_flow.data() + segment_flow.size(), flow.begin());
+      J = 2*q.dot(enclosed);
+    }
+
+    // Sectorial coordinates of the nodes with the pole at the centroid. In a
+    //   closed cell the shear flow takes up part of the twist, so the
+    //   coordinate returns to where it started around every cell.
+    std::vector<double> w(x_.size(), 0);
+    for (const auto& step : steps_) {
+      const Segment& s = segments_[step.segment];
+      const double xi = x_[step.from] - x0 - cx, yi = y_[step.from] - y0 - cy;
+      const double xj = x_[step.to] - x0 - cx, yj = y_[step.to] - y0 - cy;
+      const double q = s.start == step.from ? flow[step.segment] : -flow[step.segment];
+      w[step.to] = w[step.from] + xi*yj - xj*yi - q*std::hypot(xj - xi, yj - yi)/s.t;
+    }
+
+    // The walls of a cell resist twist by their shear flow, and the other
+    //   walls by their thickness alone
+    double Iwx = 0, Iwy = 0;
+    for (std::size_t i = 0; i != segments_.size(); ++i) {
+      const Segment& s = segments_[i];
+      const double xi = x_[s.start] - x0 - cx, yi = y_[s.start] - y0 - cy;
+      const double xj = x_[s.end] - x0 - cx, yj = y_[s.end] - y0 - cy;
+      const double wi = w[s.start], wj = w[s.end];
+      const double a = s.t*std::hypot(xj - xi, yj - yi);
+      Iwx += a*(2*wi*xi + 2*wj*xj + wi*xj + wj*xi)/6;
+      Iwy += a*(2*wi*yi + 2*wj*yj + wi*yj + wj*yi)/6;
+      if (!in_cell[i]) {
+        J += a*s.t*s.t/3;
+      }
+    }
+
+    // The shear center is the pole about which the sectorial products of
+    //   area vanish. A straight section has no sectorial coordinate.
+    double ax = 0, ay = 0;
+    const double D = Ixx*Iyy - Ixy*Ixy;
+    if (D > 1e-12*(Ixx + Iyy)*(Ixx + Iyy)) {
+      ax = (Iyy*Iwy - Ixy*Iwx)/D;
+      ay = (Ixy*Iwy - Ixx*Iwx)/D;
+    }
+
+    // The warping constant uses the sectorial coordinate about the shear
+    //   center, normalized to have no average over the section
+    double W = 0, W2 = 0;
+    for (const auto& s : segments_) {
+      const double xi = x_[s.start] - x0 - cx, yi = y_[s.start] - y0 - cy;
+      const double xj = x_[s.end] - x0 - cx, yj = y_[s.end] - y0 - cy;
+      const double wi = w[s.start] - ax*yi + ay*xi;
+      const double wj = w[s.end] - ax*yj + ay*xj;
+      const double a = s.t*std::hypot(xj - xi, yj - yi);
+      W += a*(wi + wj)/2;
+      W2 += a*(wi*wi + wi*wj + wj*wj)/3;
+    }
+
+    const LengthVec shear_center(Length(x0 + cx + ax), Length(y0 + cy + ay), 0_m);
+    return Geometry(area, ixx, iyy, ixy, centroid, extents, std::nullopt, std::nullopt,
+                    TorsionProperties(SecondMomentOfArea(J), WarpingConstant(W2 - W*W/A),
+                                      shear_center));
+  }
+
+};  // namespace eng
@@ -0,0 +1,140 @@
+#pragma once
+
+/*****************************************************************//**
+ * \file   ThinWalledSection.h
+ * \brief  A thin-walled section built from straight plate segments, which
+ *           solves for the torsion constant, warping constant and shear
+ *           center of arbitrary open and closed shapes
+ *
+ *
+ * \author bltan
+ * \date   October 2026
+ *********************************************************************/
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "Geometry.h"
+
+namespace eng {
+
+  /** A thin-walled section described by the middle line of its walls. Nodes
+   *    are points on the middle line and segments are straight walls of
+   *    constant thickness between two nodes. The section properties follow
+   *    Vlasov's theory of thin-walled beams, which integrates the sectorial
+   *    coordinate along each segment in closed form. Closed cells carry
+   *    the circulating shear flows of Bredt's theory, which are solved from
+   *    the compatibility of the twist of every cell, and the sectorial
+   *    coordinate is corrected by them.
+   *
+   *  The order in which the segments are walked is found as segments are
+   *    added and reused, so moving nodes or changing thicknesses to evaluate
+   *    many similar sections only repeats the integration, and a finished
+   *    section is never changed by reading it.
+   * \class ThinWalledSection
+   * \addtogroup Geometric
+   */
+  class ThinWalledSection {
+  public:
+    ThinWalledSection() = default;
+
+    /**
+     * \brief Add a node on the middle line of the section
+     *
+     * \param x The x location of the node
+     * \param y The y location of the node
+     * \return The index of the new node
+     */
+    std::size_t add_node(const Length& x, const Length& y);
+    /**
+     * \brief Add a straight wall between two nodes
+     *
+     * \param start The index of the first node
+     * \param end The index of the second node
+     * \param t The thickness of the wall
+     * \return The index of the new segment, or nothing if either node does
+     *   not exist, the nodes are the same or the thickness is not positive
+     */
+    std::optional<std::size_t> add_segment(const std::size_t& start, const std::size_t& end,
+                                           const Length& t);
+
+    /**
+     * \brief Move an existing node, keeping the connections of the section
+     *
+     * \param node The index of the node
+     * \param x The new x location of the node
+     * \param y The new y location of the node
+     * \return If the node exists
+     */
+    bool move_node(const std::size_t& node, const Length& x, const Length& y);
+    /**
+     * \brief Change the thickness of an existing wall
+     *
+     * \param segment The index of the segment
+     * \param t The new thickness of the wall
+     * \return If the segment exists and the thickness is positive
+     */
+    bool set_thickness(const std::size_t& segment, const Length& t);
+
+    std::size_t nodes() const { return x_.size(); }
+    std::size_t segments() const { return segments_.size(); }
+
+    /** Returns true if every segment is connected to the others, so the
+     *    section acts as one piece. The torsion properties are only known
+     *    for connected sections.
+     */
+    bool is_connected() const;
+    /** Returns true if the segments form a single connected, open section
+     *    with no closed cells.
+     */
+    bool is_open() const;
+    /** Returns the number of independent closed cells of the section.
+     */
+    std::size_t cells() const;
+
+    /**
+     * \brief Calculate the Geometry of the section
+     *
+     * \return The Geometry, including the torsion properties if the section
+     *   is connected
+     */
+    Geometry geometry() const;
+
+  private:
+    struct Segment {
+      std::size_t start;
+      std::size_t end;
+      double t;
+    };
+
+    /* A segment in walking order, where the sectorial coordinate at the
+     * from node is always known before the segment is reached. */
+    struct Step {
+      std::size_t segment;
+      std::size_t from;
+      std::size_t to;
+    };
+
+    /* A segment walked around a cell, forwards from its start to its end
+     * or backwards. */
+    struct Wall {
+      std::size_t segment;
+      bool forward;
+    };
+
+    void walk();
+
+    std::vector<double> x_;
+    std::vector<double> y_;
+    std::vector<Segment> segments_;
+
+    /* The walking order and the walls around each cell depend only on the
+     * connections between nodes, so they are found again only when a
+     * segment is added. */
+    bool connected_ = false;
+    std::vector<Step> steps_;
+    std::vector<std::vector<Wall>> cells_;
+  };
+
+};  // namespace eng
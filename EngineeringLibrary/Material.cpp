@@ -1,7 +1,124 @@
 #include "pch.h"
 #include "Material.h"
+#include "Designation.h"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
 
 namespace eng {
+
+  namespace {
+
+    constexpr double MPa = 1e6;
+    constexpr double GPa = 1e9;
+
+    constexpr MaterialGrade steel(const char* designation, double Sy, double St) {
+      return MaterialGrade(designation, Sy*MPa, St*MPa, 207.0*GPa, 79.3*GPa, 0.292);
+    }
+
+    constexpr MaterialGrade aluminum(const char* designation, double Sy, double St) {
+      return MaterialGrade(designation, Sy*MPa, St*MPa, 71.7*GPa, 26.9*GPa, 0.333);
+    }
+
+    constexpr MaterialGrade stainless(const char* designation, double Sy, double St) {
+      return MaterialGrade(designation, Sy*MPa, St*MPa, 190.0*GPa, 73.1*GPa, 0.305);
+    }
+
+    constexpr std::array<MaterialGrade, 34> grades = {
+      // Hot rolled and cold drawn AISI steels, from Shigley Table A-20
+      steel("1006 HR", 170, 300),
+      steel("1006 CD", 280, 330),
+      steel("1010 HR", 180, 320),
+      steel("1010 CD", 200, 370),
+      steel("1015 HR", 190, 340),
+      steel("1015 CD", 320, 390),
+      steel("1018 HR", 220, 400),
+      steel("1018 CD", 370, 440),
+      steel("1020 HR", 210, 380),
+      steel("1020 CD", 390, 470),
+      steel("1030 HR", 260, 470),
+      steel("1030 CD", 440, 520),
+      steel("1035 HR", 270, 500),
+      steel("1035 CD", 460, 550),
+      steel("1040 HR", 290, 520),
+      steel("1040 CD", 490, 590),
+      steel("1045 HR", 310, 570),
+      steel("1045 CD", 530, 630),
+      steel("1050 HR", 340, 620),
+      steel("1050 CD", 580, 690),
+      steel("1060 HR", 370, 680),
+      steel("1080 HR", 420, 770),
+      steel("1095 HR", 460, 830),
+      // Wrought aluminum alloys, from Shigley Table A-24
+      aluminum("1100-H14", 117, 124),
+      aluminum("2011-T3", 296, 379),
+      aluminum("2014-T6", 414, 483),
+      aluminum("2024-T3", 345, 483),
+      aluminum("3003-H14", 145, 152),
+      aluminum("5052-H32", 193, 228),
+      aluminum("6061-T6", 276, 310),
+      aluminum("6063-T6", 214, 241),
+      aluminum("7075-T6", 503, 572),
+      // Annealed austenitic stainless steels
+      stainless("304 A", 205, 515),
+      stainless("316 A", 205, 515),
+    };
+
+    /* The table is a perfect hash: the FNV-1a hash of each designation is
+     *   mixed with a seed, and the seed is searched for at compile time until
+     *   every material lands in its own slot. With four times as many slots as
+     *   materials the first few seeds almost always work. A lookup then only
+     *   ever compares one designation. */
+    constexpr std::size_t slot_bits = 8;
+    constexpr std::size_t slot_count = std::size_t(1) << slot_bits;
+    constexpr std::uint8_t empty_slot = 0xFF;
+    static_assert(grades.size() < empty_slot && grades.size() * 4 <= slot_count,
+                  "The material table is too full");
+
+    constexpr std::size_t slot(const std::uint32_t& h, const std::uint32_t& seed) {
+      std::uint32_t x = h ^ (seed * 0x9E3779B9u);
+      x = (x ^ (x >> 16)) * 0x85EBCA6Bu;
+      return (x ^ (x >> 13)) >> (32 - slot_bits);
+    }
+
+    constexpr std::uint32_t find_seed() {
+      std::array<std::uint32_t, grades.size()> hashes{};
+      for (std::size_t i = 0; i != grades.size(); ++i) {
+        hashes[i] = designation::hash(grades[i].designation());
+      }
+      for (std::uint32_t seed = 0; seed != 65536; ++seed) {
+        std::uint64_t used[slot_count/64] = {};
+        bool perfect = true;
+        for (std::size_t i = 0; i != grades.size() && perfect; ++i) {
+          const std::size_t s = slot(hashes[i], seed);
+          perfect = (used[s/64] & (std::uint64_t(1) << (s % 64))) == 0;
+          used[s/64] |= std::uint64_t(1) << (s % 64);
+        }
+        if (perfect) {
+          return seed;
+        }
+      }
+      return 0xFFFFFFFFu;
+    }
+
+    constexpr std::uint32_t seed = find_seed();
+    static_assert(seed != 0xFFFFFFFFu, "No perfect hash was found for the material table");
+
+    constexpr std::array<std::uint8_t, slot_count> make_slots() {
+      std::array<std::uint8_t, slot_count> slots{};
+      for (auto& s : slots) {
+        s = empty_slot;
+      }
+      for (std::size_t i = 0; i != grades.size(); ++i) {
+        slots[slot(designation::hash(grades[i].designation()), seed)] = static_cast<std::uint8_t>(i);
+      }
+      return slots;
+    }
+
+    constexpr std::array<std::uint8_t, slot_count> slots = make_slots();
+
+  };
   /* 
    * MaterialBase
    */
@@ -10,7 +127,29 @@ namespace eng {
                              const double& poissons_ratio) :
     _youngs_modulus(youngs_modulus),
     _rigidity_modulus(rigidity_modulus),
-    _poissons_ratio(poissons_ratio) { }
+    _poissons_ratio(poissons_ratio) {
+    const double E = _youngs_modulus.Pa();
+    const double nu = _poissons_ratio;
+    _inverse_E = 1/E;
+    _inverse_G = 1/_rigidity_modulus.Pa();
+    _lambda = E*nu/((1 + nu)*(1 - 2*nu));
+    _bulk_modulus = E/(3*(1 - 2*nu));
+    _plane_stress_modulus = E/(1 - nu*nu);
+  }
+
+  MaterialBase::MaterialBase(const Stress& youngs_modulus, const double& poissons_ratio) :
+    MaterialBase(youngs_modulus, youngs_modulus/(2*(1 + poissons_ratio)), poissons_ratio) { }
+
+  bool MaterialBase::consistent(const double& tolerance) const {
+    const double E = _youngs_modulus.Pa();
+    const double G = _rigidity_modulus.Pa();
+    const double nu = _poissons_ratio;
+    if (!(E > 0 && G > 0 && nu > -1 && nu < 0.5)) {
+      return false;
+    }
+    const double isotropic = E/(2*(1 + nu));
+    return std::abs(G - isotropic) <= tolerance*isotropic;
+  }
 
   /* 
    * Material
@@ -28,4 +167,46 @@ namespace eng {
     _tensile_str(tensile_strength),
     MaterialBase(base_material) { }
 
+  /*
+   * MaterialGrade
+   */
+
+  Material MaterialGrade::material() const {
+    return Material(Sy(), St(), E(), G(), _nu);
+  }
+
+  namespace basic_materials {
+
+    const MaterialBase aluminum{71.7_GPa, 26.9_GPa, 0.333};
+    const MaterialBase brass{106.0_GPa, 40.1_GPa, 0.324};
+    const MaterialBase steel{207.0_GPa, 79.3_GPa, 0.292};
+    const MaterialBase cast_iron{100.0_GPa, 41.4_GPa, 0.211};
+    const MaterialBase copper{119.0_GPa, 44.7_GPa, 0.326};
+    const MaterialBase lead{36.5_GPa, 13.1_GPa, 0.425};
+    const MaterialBase magnesium{44.8_GPa, 16.5_GPa, 0.350};
+    const MaterialBase stainless_steel{190.0_GPa, 73.1_GPa, 0.305};
+    const MaterialBase titanium{114.0_GPa, 42.4_GPa, 0.340};
+
+    const MaterialGrade* find(std::string_view designation) {
+      const std::uint8_t i = slots[slot(designation::hash(designation), seed)];
+      if (i == empty_slot || !designation::same(grades[i].designation(), designation)) {
+        return nullptr;
+      }
+      return &grades[i];
+    }
+
+    std::size_t size() {
+      return grades.size();
+    }
+
+    const MaterialGrade* begin() {
+      return grades.data();
+    }
+
+    const MaterialGrade* end() {
+      return grades.data() + grades.size();
+    }
+
+  };  // namespace basic_materials
+
 };  // namespace eng
@@ -9,7 +9,8 @@
  * \date   August 2020
  *********************************************************************/
 
-#include <unordered_map>
+#include <cstddef>
+#include <string_view>
 
 #include "Units/Pressure.h"
 
@@ -20,7 +21,9 @@ namespace eng {
 
   /**
    * \class MaterialBase Base material properties which are constant 
-   *    regardless of material processes.
+   *    regardless of material processes. The elastic constants which are
+   *    derived from E and nu are found once on construction, so formulas
+   *    evaluated many times read them instead of dividing again.
    */
   class MaterialBase {
   public:
@@ -33,6 +36,14 @@ namespace eng {
      */
     MaterialBase(const Stress& youngs_modulus, const Stress& rigidity_modulus, 
                  const double& poissons_ratio);
+    /**
+     * \brief MaterialBase constructor for an isotropic material, where the
+     *   modulus of rigidity is found from E/(2(1 + nu))
+     *
+     * \param youngs_modulus Young's modulus for the given material
+     * \param poissons_ratio Poisson's ratio of the given material
+     */
+    MaterialBase(const Stress& youngs_modulus, const double& poissons_ratio);
     ~MaterialBase() = default;
 
     Stress modulus_elasticity() const { return _youngs_modulus; }
@@ -43,10 +54,32 @@ namespace eng {
     Stress G() const { return _rigidity_modulus; }
     double nu() const { return _poissons_ratio; }
 
+    /* 1/E in 1/Pa */
+    double inverse_E() const { return _inverse_E; }
+    /* 1/G in 1/Pa */
+    double inverse_G() const { return _inverse_G; }
+    /* Lame's first parameter, E nu/((1 + nu)(1 - 2 nu)) */
+    Stress lambda() const { return Stress(_lambda); }
+    /* The bulk modulus, E/(3(1 - 2 nu)) */
+    Stress K() const { return Stress(_bulk_modulus); }
+    /* The plane stress modulus, E/(1 - nu^2) */
+    Stress plane_stress_modulus() const { return Stress(_plane_stress_modulus); }
+
+    /* If the properties are physically admissible, with positive moduli and
+     * -1 < nu < 0.5, and G is within a relative tolerance of E/(2(1 + nu))
+     * as it must be for an isotropic material */
+    bool consistent(const double& tolerance = 0.05) const;
+
   protected:
     Stress _youngs_modulus;
     Stress _rigidity_modulus;
     double _poissons_ratio;
+
+    double _inverse_E;
+    double _inverse_G;
+    double _lambda;
+    double _bulk_modulus;
+    double _plane_stress_modulus;
   };
 
   /**
@@ -88,45 +121,100 @@ namespace eng {
     Stress _tensile_str;
   };
 
+  /**
+   * \class MaterialGrade A processed material in the compile time table of
+   *    basic_materials or in a MaterialLibrary. MaterialGrades are only ever
+   *    accessed by pointer or reference, and are converted to a Material to
+   *    be used in calculations. The record is 64 bytes with no pointers, so
+   *    it can be stored in a file and mapped back into memory as is.
+   */
+  class MaterialGrade {
+  public:
+    /**
+     * \brief MaterialGrade constructor, which is used to build the table
+     *
+     * \param designation The designation of the material, such as "1018 CD",
+     *   of up to 23 characters
+     * \param Sy The yield strength in Pa
+     * \param St The ultimate tensile strength in Pa
+     * \param E Young's modulus in Pa
+     * \param G The modulus of rigidity in Pa
+     * \param nu Poisson's ratio
+     */
+    constexpr MaterialGrade(const char* designation, double Sy, double St, double E,
+                            double G, double nu) :
+      _designation(),
+      _Sy(Sy),
+      _St(St),
+      _E(E),
+      _G(G),
+      _nu(nu) {
+      for (std::size_t i = 0; i != sizeof(_designation) - 1 && designation[i] != '\0'; ++i) {
+        _designation[i] = designation[i];
+      }
+    }
+
+    constexpr std::string_view designation() const { return _designation; }
+    Stress Sy() const { return Stress(_Sy); }
+    Stress St() const { return Stress(_St); }
+    Stress E() const { return Stress(_E); }
+    Stress G() const { return Stress(_G); }
+    double nu() const { return _nu; }
+
+    Material material() const;
+
+    /* The longest designation which can be stored */
+    static constexpr std::size_t max_designation = 23;
+
+  private:
+    char _designation[max_designation + 1];
+    double _Sy;
+    double _St;
+    double _E;
+    double _G;
+    double _nu;
+  };
+
   namespace basic_materials {
 
-    // Some basic materials for use
-    const static eng::MaterialBase aluminum{71.7_GPa,  26.9_GPa, 0.333};
-    const static eng::MaterialBase brass{106.0_GPa, 40.1_GPa, 0.324};
-    const static eng::MaterialBase steel{207.0_GPa, 79.3_GPa, 0.292};
-    const static eng::MaterialBase cast_iron{100.0_GPa, 41.4_GPa, 0.211};
-    const static eng::MaterialBase copper{119.0_GPa, 44.7_GPa, 0.326};
-    const static eng::MaterialBase lead{36.5_GPa,  13.1_GPa, 0.425};
-    const static eng::MaterialBase magnesium{44.8_GPa,  16.5_GPa, 0.350};
-    const static eng::MaterialBase stainless_steel{190.0_GPa, 73.1_GPa, 0.305};
-    const static eng::MaterialBase titanium{114.0_GPa, 42.4_GPa, 0.340};
-
-    // Processed steels and their properties, specified with AISI designations
-    const static std::unordered_map<const char*, eng::Material> steels({
-      {"1006 HR", eng::Material{170_MPa, 300_MPa, steel}},
-      {"1006 CD", eng::Material{280_MPa, 330_MPa, steel}},
-      {"1010 HR", eng::Material{180_MPa, 320_MPa, steel}},
-      {"1010 CD", eng::Material{200_MPa, 370_MPa, steel}},
-      {"1015 HR", eng::Material{190_MPa, 340_MPa, steel}},
-      {"1015 CD", eng::Material{320_MPa, 390_MPa, steel}},
-      {"1018 HR", eng::Material{220_MPa, 400_MPa, steel}},
-      {"1018 CD", eng::Material{370_MPa, 440_MPa, steel}},
-      {"1020 HR", eng::Material{210_MPa, 380_MPa, steel}},
-      {"1020 CD", eng::Material{390_MPa, 470_MPa, steel}},
-      {"1030 HR", eng::Material{260_MPa, 470_MPa, steel}},
-      {"1030 CD", eng::Material{440_MPa, 520_MPa, steel}},
-      {"1035 HR", eng::Material{270_MPa, 500_MPa, steel}},
-      {"1035 CD", eng::Material{460_MPa, 550_MPa, steel}},
-      {"1040 HR", eng::Material{290_MPa, 520_MPa, steel}},
-      {"1040 CD", eng::Material{490_MPa, 590_MPa, steel}},
-      {"1045 HR", eng::Material{310_MPa, 570_MPa, steel}},
-      {"1045 CD", eng::Material{530_MPa, 630_MPa, steel}},
-      {"1050 HR", eng::Material{340_MPa, 620_MPa, steel}},
-      {"1050 CD", eng::Material{580_MPa, 690_MPa, steel}},
-      {"1060 HR", eng::Material{370_MPa, 680_MPa, steel}},
-      {"1080 HR", eng::Material{420_MPa, 770_MPa, steel}},
-      {"1095 HR", eng::Material{460_MPa, 830_MPa, steel}}
-                                                                       });
+    // Some basic materials for use, defined once in Material.cpp
+    extern const eng::MaterialBase aluminum;
+    extern const eng::MaterialBase brass;
+    extern const eng::MaterialBase steel;
+    extern const eng::MaterialBase cast_iron;
+    extern const eng::MaterialBase copper;
+    extern const eng::MaterialBase lead;
+    extern const eng::MaterialBase magnesium;
+    extern const eng::MaterialBase stainless_steel;
+    extern const eng::MaterialBase titanium;
+
+    /* The steels map which was here has been replaced by find(), which also
+     * holds aluminum alloys and stainless steels. Code which used
+     *   basic_materials::steels.at("1018 CD")
+     * now uses
+     *   basic_materials::find("1018 CD")->material()
+     * after checking the pointer, since find() returns nullptr instead of
+     * throwing for a designation which is not in the table. */
+
+    /**
+     * \brief Find a processed material by its designation, such as the AISI
+     *   steel "1018 CD", the aluminum alloy "6061-T6" or the stainless steel
+     *   "304 A". Letter case and spaces are ignored. The table is built at
+     *   compile time, so the lookup hashes the designation once and compares
+     *   it to a single entry, with no allocation.
+     *
+     * \param designation The designation of the material
+     * \return A pointer to the material, or nullptr if it is not in the table
+     */
+    const MaterialGrade* find(std::string_view designation);
+
+    /** Returns the number of processed materials in the table. */
+    std::size_t size();
+    /** Returns a pointer to the first processed material in the table. */
+    const MaterialGrade* begin();
+    /** Returns a pointer past the last processed material in the table. */
+    const MaterialGrade* end();
+
   }; // namespace basic_materials
 
 }; // namespace eng
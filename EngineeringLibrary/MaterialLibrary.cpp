@@ -0,0 +1,358 @@
+#include "pch.h"
+#include "MaterialLibrary.h"
+#include "Designation.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <type_traits>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace eng {
+
+  namespace {
+
+    constexpr char cache_magic[8] = {'E', 'N', 'G', 'M', 'A', 'T', 'L', '\0'};
+    constexpr std::uint32_t cache_version = 1;
+
+    /* The header of a binary cache, padded so the records after it keep
+     *   their alignment */
+    struct CacheHeader {
+      char magic[8];
+      std::uint32_t version;
+      std::uint32_t record_size;
+      std::uint64_t count;
+      std::int64_t source_time;
+      std::uint64_t source_size;
+      char reserved[24];
+    };
+    static_assert(sizeof(CacheHeader) == 64, "The cache header must be 64 bytes");
+    static_assert(sizeof(MaterialGrade) == 64, "A cache record must be 64 bytes");
+    static_assert(std::is_trivially_copyable<MaterialGrade>::value,
+                  "Cache records are written and mapped as raw bytes");
+    static_assert(std::is_standard_layout<MaterialGrade>::value,
+                  "The designation must be the first bytes of a cache record");
+
+    std::string_view trim(std::string_view s) {
+      const std::size_t first = s.find_first_not_of(" \t\r");
+      if (first == std::string_view::npos) {
+        return {};
+      }
+      return s.substr(first, s.find_last_not_of(" \t\r") - first + 1);
+    }
+
+    /* Split a line of a CSV file into its trimmed fields */
+    void split(std::string_view line, std::vector<std::string_view>& fields) {
+      fields.clear();
+      while (true) {
+        const std::size_t comma = line.find(',');
+        fields.push_back(trim(line.substr(0, comma)));
+        if (comma == std::string_view::npos) {
+          return;
+        }
+        line.remove_prefix(comma + 1);
+      }
+    }
+
+    bool parse(std::string_view field, double& value) {
+      const auto result = std::from_chars(field.data(), field.data() + field.size(), value);
+      return result.ec == std::errc() && result.ptr == field.data() + field.size();
+    }
+
+    /* The write time and size of a file, or nothing if it does not exist */
+    std::optional<std::pair<std::int64_t, std::uint64_t>> stamp(const std::string& path) {
+      std::error_code error;
+      const auto time = std::filesystem::last_write_time(path, error);
+      if (error) {
+        return std::nullopt;
+      }
+      const auto size = std::filesystem::file_size(path, error);
+      if (error) {
+        return std::nullopt;
+      }
+      return std::make_pair(static_cast<std::int64_t>(time.time_since_epoch().count()),
+                            static_cast<std::uint64_t>(size));
+    }
+
+    /* Map a whole file into memory read only, returning nullptr if it fails */
+    const void* map_file(const std::string& path, std::size_t& size) {
+#ifdef _WIN32
+      HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+      if (file == INVALID_HANDLE_VALUE) {
+        return nullptr;
+      }
+      LARGE_INTEGER length;
+      const void* view = nullptr;
+      if (GetFileSizeEx(file, &length) && length.QuadPart > 0) {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping != nullptr) {
+          // the view keeps the mapping alive after its handle is closed
+          view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+          size = static_cast<std::size_t>(length.QuadPart);
+          CloseHandle(mapping);
+        }
+      }
+      CloseHandle(file);
+      return view;
+#else
+      const int file = ::open(path.c_str(), O_RDONLY);
+      if (file < 0) {
+        return nullptr;
+      }
+      struct stat status;
+      void* view = nullptr;
+      if (fstat(file, &status) == 0 && status.st_size > 0) {
+        size = static_cast<std::size_t>(status.st_size);
+        view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+        view = view == MAP_FAILED ? nullptr : view;
+      }
+      ::close(file);
+      return view;
+#endif
+    }
+
+    void unmap_file(const void* view, const std::size_t& size) {
+#ifdef _WIN32
+      UnmapViewOfFile(view);
+#else
+      munmap(const_cast<void*>(view), size);
+#endif
+    }
+
+  };
+
+  MaterialLibrary::MaterialLibrary() :
+    _grades(nullptr),
+    _count(0),
+    _view(nullptr),
+    _view_size(0),
+    _source_time(0),
+    _source_size(0) { }
+
+  MaterialLibrary::MaterialLibrary(MaterialLibrary&& library) noexcept :
+    _owned(std::move(library._owned)),
+    _grades(library._grades),
+    _count(library._count),
+    _view(library._view),
+    _view_size(library._view_size),
+    _source_time(library._source_time),
+    _source_size(library._source_size) {
+    library._grades = nullptr;
+    library._count = 0;
+    library._view = nullptr;
+  }
+
+  MaterialLibrary& MaterialLibrary::operator=(MaterialLibrary&& library) noexcept {
+    if (this != &library) {
+      release();
+      _owned = std::move(library._owned);
+      _grades = library._grades;
+      _count = library._count;
+      _view = library._view;
+      _view_size = library._view_size;
+      _source_time = library._source_time;
+      _source_size = library._source_size;
+      library._grades = nullptr;
+      library._count = 0;
+      library._view = nullptr;
+    }
+    return *this;
+  }
+
+  MaterialLibrary::~MaterialLibrary() {
+    release();
+  }
+
+  void MaterialLibrary::release() {
+    if (_view != nullptr) {
+      unmap_file(_view, _view_size);
+      _view = nullptr;
+    }
+    _owned.clear();
+    _grades = nullptr;
+    _count = 0;
+  }
+
+  std::optional<MaterialLibrary> MaterialLibrary::read_csv(const std::string& path) {
+    const auto source = stamp(path);
+    std::ifstream file(path);
+    if (!source || !file) {
+      return std::nullopt;
+    }
+
+    enum Column { DESIGNATION, SY, ST, E, G, NU, COLUMNS };
+    constexpr std::string_view names[COLUMNS] = {"designation", "Sy", "St", "E", "G", "nu"};
+    std::size_t columns[COLUMNS];
+    std::size_t missing = 0;
+    bool header = false;
+
+    MaterialLibrary library;
+    std::vector<std::string_view> fields;
+    std::string line;
+    while (std::getline(file, line)) {
+      const std::string_view text = trim(line);
+      if (text.empty() || text.front() == '#') {
+        continue;
+      }
+      split(text, fields);
+
+      if (!header) {
+        missing = fields.size();
+        for (std::size_t c = 0; c != COLUMNS; ++c) {
+          columns[c] = std::find(fields.begin(), fields.end(), names[c]) - fields.begin();
+          if (columns[c] == missing && c != G) {
+            return std::nullopt;
+          }
+        }
+        header = true;
+        continue;
+      }
+
+      double values[COLUMNS] = {};
+      for (std::size_t c = SY; c != COLUMNS; ++c) {
+        if (columns[c] == missing) {
+          continue;
+        }
+        if (columns[c] >= fields.size() || !parse(fields[columns[c]], values[c])) {
+          return std::nullopt;
+        }
+      }
+      if (columns[DESIGNATION] >= fields.size()) {
+        return std::nullopt;
+      }
+      const std::string designation(fields[columns[DESIGNATION]]);
+      if (designation.empty() || designation.size() > MaterialGrade::max_designation) {
+        return std::nullopt;
+      }
+      const double E_Pa = values[E]*1e9;
+      const double G_Pa = columns[G] == missing ? E_Pa/(2*(1 + values[NU])) : values[G]*1e9;
+      library._owned.emplace_back(designation.c_str(), values[SY]*1e6, values[ST]*1e6, E_Pa, G_Pa,
+                                  values[NU]);
+    }
+    if (!header) {
+      return std::nullopt;
+    }
+
+    // sort by designation, keeping the last of any repeated designation
+    auto& owned = library._owned;
+    std::stable_sort(owned.begin(), owned.end(), [](const MaterialGrade& l, const MaterialGrade& r) {
+      return designation::compare(l.designation(), r.designation()) < 0;
+    });
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i != owned.size(); ++i) {
+      if (kept != 0 &&
+          designation::compare(owned[kept - 1].designation(), owned[i].designation()) == 0) {
+        owned[kept - 1] = owned[i];
+      }
+      else {
+        owned[kept++] = owned[i];
+      }
+    }
+    owned.erase(owned.begin() + kept, owned.end());
+
+    library._grades = owned.data();
+    library._count = owned.size();
+    library._source_time = source->first;
+    library._source_size = source->second;
+    return library;
+  }
+
+  std::optional<MaterialLibrary> MaterialLibrary::map_cache(const std::string& path) {
+    MaterialLibrary library;
+    library._view = map_file(path, library._view_size);
+    if (library._view == nullptr) {
+      return std::nullopt;
+    }
+
+    CacheHeader header;
+    if (library._view_size < sizeof(header)) {
+      return std::nullopt;
+    }
+    std::memcpy(&header, library._view, sizeof(header));
+    if (std::memcmp(header.magic, cache_magic, sizeof(cache_magic)) != 0 ||
+        header.version != cache_version || header.record_size != sizeof(MaterialGrade) ||
+        library._view_size != sizeof(header) + header.count*sizeof(MaterialGrade)) {
+      return std::nullopt;
+    }
+
+    // Every designation must end within its record, and the records must be
+    //   sorted for find, or the file was not written by write_cache
+    const char* records = static_cast<const char*>(library._view) + sizeof(header);
+    const MaterialGrade* grades = reinterpret_cast<const MaterialGrade*>(records);
+    for (std::size_t i = 0; i != header.count; ++i) {
+      if (std::memchr(records + i*sizeof(MaterialGrade), '\0',
+                      MaterialGrade::max_designation + 1) == nullptr ||
+          (i != 0 && designation::compare(grades[i - 1].designation(),
+                                          grades[i].designation()) >= 0)) {
+        return std::nullopt;
+      }
+    }
+
+    library._grades = grades;
+    library._count = static_cast<std::size_t>(header.count);
+    library._source_time = header.source_time;
+    library._source_size = header.source_size;
+    return library;
+  }
+
+  std::optional<MaterialLibrary> MaterialLibrary::open(const std::string& csv_path,
+                                                       const std::string& cache_path) {
+    auto cache = map_cache(cache_path);
+    const auto source = stamp(csv_path);
+    if (cache && (!source || (cache->_source_time == source->first &&
+                              cache->_source_size == source->second))) {
+      return cache;
+    }
+
+    auto library = read_csv(csv_path);
+    if (!library) {
+      return cache;
+    }
+    // the old cache must be unmapped before it can be replaced
+    cache.reset();
+    if (library->write_cache(cache_path)) {
+      if (auto rebuilt = map_cache(cache_path)) {
+        return rebuilt;
+      }
+    }
+    return library;
+  }
+
+  bool MaterialLibrary::write_cache(const std::string& path) const {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      return false;
+    }
+    CacheHeader header = {};
+    std::memcpy(header.magic, cache_magic, sizeof(cache_magic));
+    header.version = cache_version;
+    header.record_size = sizeof(MaterialGrade);
+    header.count = _count;
+    header.source_time = _source_time;
+    header.source_size = _source_size;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(_grades), _count*sizeof(MaterialGrade));
+    return static_cast<bool>(file.flush());
+  }
+
+  const MaterialGrade* MaterialLibrary::find(std::string_view designation) const {
+    const MaterialGrade* it = std::lower_bound(begin(), end(), designation,
+      [](const MaterialGrade& grade, std::string_view d) {
+        return designation::compare(grade.designation(), d) < 0;
+      });
+    if (it == end() || designation::compare(it->designation(), designation) != 0) {
+      return nullptr;
+    }
+    return it;
+  }
+
+};  // namespace eng
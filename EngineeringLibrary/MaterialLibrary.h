@@ -0,0 +1,105 @@
+#pragma once
+
+/*****************************************************************//**
+ * \file  MaterialLibrary.h
+ * \brief A library of processed materials loaded from a text file at run
+ *          time, with a binary cache which is memory mapped on later runs
+ *
+ * \author bltan
+ * \date   October 2026
+ *********************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Material.h"
+
+namespace eng {
+
+  /**
+   * \class MaterialLibrary A table of processed materials which are not
+   *    compiled into the library, such as proprietary alloys.
+   *
+   *    The materials are read from a CSV file with a header row naming the
+   *    columns designation, Sy, St, E, G and nu in any order. Strengths are
+   *    in MPa and moduli in GPa, G may be left out to find it from E and nu,
+   *    and lines starting with # are comments. If a designation appears more
+   *    than once, the last line is kept.
+   *
+   *    A library can be written to a versioned binary cache of MaterialGrade
+   *    records sorted by designation. Opening the cache maps it into memory,
+   *    so nothing is parsed or copied, and lookups return pointers into the
+   *    mapped records. The library is move only, and the pointers it returns
+   *    are valid until it is destroyed.
+   */
+  class MaterialLibrary {
+  public:
+    MaterialLibrary(MaterialLibrary&& library) noexcept;
+    MaterialLibrary& operator=(MaterialLibrary&& library) noexcept;
+    MaterialLibrary(const MaterialLibrary&) = delete;
+    MaterialLibrary& operator=(const MaterialLibrary&) = delete;
+    ~MaterialLibrary();
+
+    /**
+     * \brief Read the materials of a CSV file into memory
+     *
+     * \param path The path of the CSV file
+     * \return The library, or nothing if the file can not be read, the header
+     *   is missing a column, or a line has a bad number or a designation
+     *   longer than MaterialGrade::max_designation characters
+     */
+    static std::optional<MaterialLibrary> read_csv(const std::string& path);
+    /**
+     * \brief Map a binary cache written by write_cache into memory
+     *
+     * \param path The path of the cache
+     * \return The library, or nothing if the file can not be mapped, was
+     *   written by a different version of the format, or has a designation
+     *   which is not terminated or out of order
+     */
+    static std::optional<MaterialLibrary> map_cache(const std::string& path);
+    /**
+     * \brief Open the materials of a CSV file through a binary cache. The
+     *   cache is mapped if it was written from the file as it is now, and is
+     *   otherwise rebuilt from the file first.
+     *
+     * \param csv_path The path of the CSV file
+     * \param cache_path The path of the binary cache
+     * \return The library, or nothing if neither file can be read
+     */
+    static std::optional<MaterialLibrary> open(const std::string& csv_path,
+                                               const std::string& cache_path);
+
+    /* Write the library to a binary cache, returning false if it fails */
+    bool write_cache(const std::string& path) const;
+
+    /* If the records are mapped from a cache rather than held in memory */
+    bool mapped() const { return _view != nullptr; }
+
+    /* Find a material by its designation, ignoring letter case and spaces.
+     * Returns nullptr if it is not in the library. */
+    const MaterialGrade* find(std::string_view designation) const;
+
+    std::size_t size() const { return _count; }
+    const MaterialGrade* begin() const { return _grades; }
+    const MaterialGrade* end() const { return _grades + _count; }
+
+  private:
+    MaterialLibrary();
+    void release();
+
+    std::vector<MaterialGrade> _owned;    /**< The records read from a CSV file */
+    const MaterialGrade* _grades;
+    std::size_t _count;
+
+    const void* _view;                    /**< The mapped cache, if any */
+    std::size_t _view_size;
+    std::int64_t _source_time;            /**< The write time of the CSV file read */
+    std::uint64_t _source_size;           /**< The size of the CSV file read */
+  };
+
+};  // namespace eng
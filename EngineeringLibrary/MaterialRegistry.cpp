@@ -0,0 +1,74 @@
+#include "pch.h"
+#include "MaterialRegistry.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace eng {
+
+  void MaterialPropertyArray::resize(const std::size_t& n) {
+    E.resize(n);
+    G.resize(n);
+    nu.resize(n);
+    Sy.resize(n);
+    St.resize(n);
+    inverse_E.resize(n);
+    inverse_G.resize(n);
+  }
+
+  bool MaterialPropertyArray::contains(const std::vector<MaterialHandle>& handles,
+                                       const std::size_t& elements) const {
+    if (handles.size() != elements) {
+      return false;
+    }
+    const std::size_t n = size();
+    return std::all_of(handles.begin(), handles.end(),
+                       [&n](const MaterialHandle& handle) { return handle < n; });
+  }
+
+  /*
+   * MaterialRegistry
+   */
+
+  std::size_t MaterialRegistry::KeyHash::operator()(const Key& key) const {
+    std::uint64_t h = 14695981039346656037ull;    // FNV-1a over the words
+    for (const auto& word : key) {
+      h = (h ^ word) * 1099511628211ull;
+    }
+    return static_cast<std::size_t>(h ^ (h >> 32));
+  }
+
+  MaterialHandle MaterialRegistry::intern(const Material& material) {
+    // materials are the same if their properties are bit for bit equal
+    const double values[5] = {material.E().Pa(), material.G().Pa(), material.nu(),
+                              material.Sy().Pa(), material.St().Pa()};
+    Key key;
+    std::memcpy(key.data(), values, sizeof(values));
+
+    const auto found = _handles.find(key);
+    if (found != _handles.end()) {
+      return found->second;
+    }
+    const MaterialHandle handle = static_cast<MaterialHandle>(_properties.size());
+    _properties.E.push_back(values[0]);
+    _properties.G.push_back(values[1]);
+    _properties.nu.push_back(values[2]);
+    _properties.Sy.push_back(values[3]);
+    _properties.St.push_back(values[4]);
+    _properties.inverse_E.push_back(material.inverse_E());
+    _properties.inverse_G.push_back(material.inverse_G());
+    _handles.emplace(key, handle);
+    return handle;
+  }
+
+  MaterialHandle MaterialRegistry::intern(const MaterialGrade& grade) {
+    return intern(grade.material());
+  }
+
+  Material MaterialRegistry::operator[](const MaterialHandle& handle) const {
+    return Material(Stress(_properties.Sy[handle]), Stress(_properties.St[handle]),
+                    Stress(_properties.E[handle]), Stress(_properties.G[handle]),
+                    _properties.nu[handle]);
+  }
+
+};  // namespace eng
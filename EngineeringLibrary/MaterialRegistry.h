@@ -0,0 +1,77 @@
+#pragma once
+
+/*****************************************************************//**
+ * \file  MaterialRegistry.h
+ * \brief A registry of interned materials, so large arrays of elements can
+ *          store a 32-bit handle to their material instead of a copy of it
+ *
+ * \author bltan
+ * \date   October 2026
+ *********************************************************************/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Material.h"
+
+namespace eng {
+
+  /* The index of a material in a MaterialRegistry */
+  using MaterialHandle = std::uint32_t;
+
+  /**
+   * \class MaterialPropertyArray The properties of many materials stored as
+   *   parallel arrays in SI units, indexed by MaterialHandle
+   */
+  struct MaterialPropertyArray {
+    std::vector<double> E;
+    std::vector<double> G;
+    std::vector<double> nu;
+    std::vector<double> Sy;
+    std::vector<double> St;
+    std::vector<double> inverse_E;    /**< 1/E, so kernels do not divide */
+    std::vector<double> inverse_G;    /**< 1/G, so kernels do not divide */
+
+    std::size_t size() const { return E.size(); }
+    void resize(const std::size_t& n);
+    /* If there is one handle per element and every handle is in the array */
+    bool contains(const std::vector<MaterialHandle>& handles, const std::size_t& elements) const;
+  };
+
+  /**
+   * \class MaterialRegistry Interns materials, so every distinct set of
+   *    properties is stored once and is referred to by a handle. The
+   *    properties are kept in a MaterialPropertyArray for kernels which
+   *    process many elements of different materials at once.
+   *
+   *    Handles are never invalidated, since materials are only ever added.
+   */
+  class MaterialRegistry {
+  public:
+    MaterialRegistry() = default;
+
+    /* Add a material, or find it if a material with the same properties has
+     * already been added, and return its handle */
+    MaterialHandle intern(const Material& material);
+    MaterialHandle intern(const MaterialGrade& grade);
+
+    std::size_t size() const { return _properties.size(); }
+    /* The properties of every material, indexed by handle */
+    const MaterialPropertyArray& properties() const { return _properties; }
+    /* Copy out the material of a handle */
+    Material operator[](const MaterialHandle& handle) const;
+
+  private:
+    using Key = std::array<std::uint64_t, 5>;
+    struct KeyHash {
+      std::size_t operator()(const Key& key) const;
+    };
+
+    MaterialPropertyArray _properties;
+    std::unordered_map<Key, MaterialHandle, KeyHash> _handles;
+  };
+
+};  // namespace eng
@@ -0,0 +1,240 @@
+#include "pch.h"
+#include "ModalAnalysis.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+
+#include <eigen3/Eigen/Eigenvalues>
+
+namespace eng {
+
+  namespace {
+
+    /* Systems this small are solved directly with a dense eigensolver */
+    constexpr Eigen::Index dense_size = 200;
+    /* The number of vectors in each Lanczos block */
+    constexpr Eigen::Index block_size = 4;
+
+    /* Keep the modes nearest the shift, in increasing order */
+    void keep_nearest(const Eigen::VectorXd& lambda, const Eigen::MatrixXd& shapes,
+                      const double& sigma, const std::size_t& modes, ModalResults& results) {
+      std::vector<Eigen::Index> order(static_cast<std::size_t>(lambda.size()));
+      std::iota(order.begin(), order.end(), Eigen::Index(0));
+      std::stable_sort(order.begin(), order.end(), [&lambda, &sigma](const Eigen::Index& l,
+                                                                    const Eigen::Index& r) {
+        return std::abs(lambda[l] - sigma) < std::abs(lambda[r] - sigma);
+      });
+      order.resize(std::min(modes, order.size()));
+      std::sort(order.begin(), order.end(), [&lambda](const Eigen::Index& l, const Eigen::Index& r) {
+        return lambda[l] < lambda[r];
+      });
+
+      results.frequencies.resize(order.size());
+      results.shapes.resize(shapes.rows(), static_cast<Eigen::Index>(order.size()));
+      for (std::size_t i = 0; i != order.size(); ++i) {
+        results.frequencies[i] = Frequency(std::sqrt(std::max(lambda[order[i]], 0.0)));
+        results.shapes.col(static_cast<Eigen::Index>(i)) = shapes.col(order[i]);
+      }
+    }
+
+  };
+
+  ModalAnalysis::ModalAnalysis(const MassMatrix& M, const StiffnessMatrix& K) :
+    _M(M.unaryExpr([](const Mass& m) { return m.value(); }).sparseView()),
+    _K(K.unaryExpr([](const Stiffness& k) { return k.value(); }).sparseView()) {
+    initialize();
+  }
+
+  ModalAnalysis::ModalAnalysis(const SparseMassMatrix& M, const SparseStiffnessMatrix& K) :
+    _M(M.unaryExpr([](const Mass& m) { return m.value(); })),
+    _K(K.unaryExpr([](const Stiffness& k) { return k.value(); })) {
+    initialize();
+  }
+
+  void ModalAnalysis::initialize() {
+    _M.makeCompressed();
+    _K.makeCompressed();
+    _factored = false;
+    _sigma = 0;
+    _factor_shift = 0;
+
+    // Rigid body modes make K singular, so the lowest modes are found about a
+    //   shift just below zero, relative to the typical k/m of the system
+    const double mass = _M.diagonal().sum();
+    const double stiffness = _K.diagonal().sum();
+    _rigid_shift = (mass > 0 && stiffness > 0) ? -1e-6*stiffness/mass : -1e-6;
+
+    // K - s M has the union of the patterns for every shift, so its ordering
+    //   and symbolic factorization are found once
+    if (_M.rows() > dense_size) {
+      _solver.analyzePattern(_K - _M);
+    }
+  }
+
+  bool ModalAnalysis::solve(const std::size_t& modes, ModalResults& results,
+                            const double& tolerance) {
+    return lanczos(modes, _rigid_shift, results, tolerance);
+  }
+
+  bool ModalAnalysis::solve(const std::size_t& modes, const Frequency& shift,
+                            ModalResults& results, const double& tolerance) {
+    const double sigma = shift.value()*shift.value();
+    return lanczos(modes, sigma > 0 ? sigma : _rigid_shift, results, tolerance);
+  }
+
+  bool ModalAnalysis::factorize(const double& sigma) {
+    if (_factored && sigma == _sigma) {
+      return true;
+    }
+    _sigma = sigma;
+    _factor_shift = sigma;
+    // A shift on a natural frequency leaves a pivot near zero, and the huge
+    //   Ritz value of that mode then swamps the ones around it in rounding.
+    //   A pivot is near zero when it is tiny next to the shifted mass at its
+    //   degree of freedom, which stiff degrees of freedom never are, so an
+    //   ill-conditioned K alone does not move the shift. Moving the shift a
+    //   little off the natural frequency keeps every Ritz value accurate.
+    for (int attempt = 0; attempt != 3; ++attempt) {
+      _solver.factorize(_K - _factor_shift*_M);
+      _factored = _solver.info() == Eigen::Success;
+      if (!_factored) {
+        return false;
+      }
+      const Eigen::VectorXd mass = _solver.permutationP()*Eigen::VectorXd(_M.diagonal());
+      const Eigen::VectorXd& pivots = _solver.vectorD();
+      bool singular = false;
+      for (Eigen::Index i = 0; i != pivots.size() && !singular; ++i) {
+        singular = std::abs(pivots[i]) <= 1e-8*std::abs(_factor_shift)*mass[i];
+      }
+      if (!singular) {
+        break;
+      }
+      _factor_shift += std::pow(10.0, 2*attempt - 5)*std::abs(sigma);
+    }
+    return true;
+  }
+
+  bool ModalAnalysis::lanczos(const std::size_t& modes, const double& sigma,
+                              ModalResults& results, const double& tolerance) {
+    const Eigen::Index n = _M.rows();
+    const Eigen::Index wanted = std::min(static_cast<Eigen::Index>(modes), n);
+    results.frequencies.clear();
+    results.shapes.resize(n, 0);
+    if (wanted == 0) {
+      return true;
+    }
+
+    if (n <= dense_size) {
+      const Eigen::MatrixXd K = _K;
+      const Eigen::MatrixXd M = _M;
+      Eigen::GeneralizedSelfAdjointEigenSolver<Eigen::MatrixXd> dense(K, M);
+      if (dense.info() != Eigen::Success) {
+        return false;
+      }
+      keep_nearest(dense.eigenvalues(), dense.eigenvectors(), sigma, wanted, results);
+      return true;
+    }
+
+    if (!factorize(sigma)) {
+      return false;
+    }
+
+    // The Krylov space of (K - s M)^-1 M grows by a block of vectors at a
+    //   time. Every vector is kept M-orthonormal to all of the others, so the
+    //   projection T = Q^T M (K - s M)^-1 M Q is symmetric and its
+    //   eigenvalues theta give the modes by lambda = s + 1/theta.
+    const Eigen::Index limit = std::min(n - n % block_size,
+                                        std::max<Eigen::Index>(6*wanted, wanted + 32*block_size));
+    Eigen::MatrixXd Q(n, limit);
+    Eigen::MatrixXd T = Eigen::MatrixXd::Zero(limit, limit);
+    std::mt19937_64 random(0x5EED);
+    std::uniform_real_distribution<double> uniform(-1, 1);
+
+    // M-orthonormalize column k of Q against every column before it, replacing
+    //   it with a random vector if it lies in their span
+    auto orthonormalize = [&](const Eigen::Index& k) {
+      for (int attempt = 0; attempt != 8; ++attempt) {
+        const double before = std::sqrt(Q.col(k).dot(_M*Q.col(k)));
+        for (int pass = 0; pass != 2; ++pass) {
+          const Eigen::VectorXd h = Q.leftCols(k).transpose()*(_M*Q.col(k));
+          Q.col(k) -= Q.leftCols(k)*h;
+        }
+        const double after = std::sqrt(Q.col(k).dot(_M*Q.col(k)));
+        if (after > 1e-10*before && after > 0) {
+          Q.col(k) /= after;
+          return;
+        }
+        for (Eigen::Index i = 0; i != n; ++i) {
+          Q(i, k) = uniform(random);
+        }
+      }
+    };
+
+    for (Eigen::Index c = 0; c != block_size; ++c) {
+      for (Eigen::Index i = 0; i != n; ++i) {
+        Q(i, c) = uniform(random);
+      }
+      orthonormalize(c);
+    }
+
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> ritz;
+    std::vector<Eigen::Index> nearest;
+    bool converged = false;
+    Eigen::Index m = 0;
+    for (Eigen::Index k = 0; k + block_size <= limit && !converged; k += block_size) {
+      m = k + block_size;
+      Eigen::MatrixXd W = _solver.solve(_M*Q.middleCols(k, block_size));
+      Eigen::MatrixXd H = Eigen::MatrixXd::Zero(m, block_size);
+      for (int pass = 0; pass != 2; ++pass) {
+        const Eigen::MatrixXd h = Q.leftCols(m).transpose()*(_M*W);
+        W -= Q.leftCols(m)*h;
+        H += h;
+      }
+      T.block(0, k, m, block_size) = H;
+
+      const Eigen::MatrixXd projected = (T.topLeftCorner(m, m) +
+                                         T.topLeftCorner(m, m).transpose())/2;
+      ritz.compute(projected);
+      const Eigen::VectorXd& theta = ritz.eigenvalues();
+
+      // the residual of each Ritz vector is W times the last block of its
+      //   eigenvector, measured in the M norm
+      const Eigen::MatrixXd G = W.transpose()*(_M*W);
+      nearest.resize(static_cast<std::size_t>(m));
+      std::iota(nearest.begin(), nearest.end(), Eigen::Index(0));
+      std::stable_sort(nearest.begin(), nearest.end(), [&theta](const Eigen::Index& l,
+                                                               const Eigen::Index& r) {
+        return std::abs(theta[l]) > std::abs(theta[r]);
+      });
+      converged = m >= wanted;
+      for (Eigen::Index i = 0; i < std::min(wanted, m) && converged; ++i) {
+        const Eigen::VectorXd s = ritz.eigenvectors().col(nearest[i]).tail(block_size);
+        const double residual = std::sqrt(std::max(s.dot(G*s), 0.0));
+        converged = residual <= tolerance*std::abs(theta[nearest[i]]);
+      }
+
+      if (!converged && m + block_size <= limit) {
+        Q.middleCols(m, block_size) = W;
+        for (Eigen::Index c = 0; c != block_size; ++c) {
+          orthonormalize(m + c);
+        }
+        T.block(m, k, block_size, block_size) =
+          Q.middleCols(m, block_size).transpose()*(_M*W);
+      }
+    }
+
+    const Eigen::Index found = std::min(wanted, m);
+    Eigen::VectorXd lambda(found);
+    Eigen::MatrixXd shapes(n, found);
+    for (Eigen::Index i = 0; i != found; ++i) {
+      lambda[i] = _factor_shift + 1/ritz.eigenvalues()[nearest[i]];
+      shapes.col(i) = Q.leftCols(m)*ritz.eigenvectors().col(nearest[i]);
+      shapes.col(i) /= std::sqrt(shapes.col(i).dot(_M*shapes.col(i)));
+    }
+    keep_nearest(lambda, shapes, sigma, static_cast<std::size_t>(found), results);
+    return converged;
+  }
+
+};  // namespace eng
@@ -0,0 +1,111 @@
+#pragma once
+
+/*****************************************************************//**
+ * \file  ModalAnalysis.h
+ * \brief Natural frequencies and mode shapes of multiple degree of freedom
+ *          systems from their mass and stiffness matrices
+ *
+ * \author bltan
+ * \date   October 2026
+ *********************************************************************/
+
+#include <cstddef>
+#include <vector>
+#include <eigen3/Eigen/Dense>
+#include <eigen3/Eigen/Sparse>
+
+#include "Units/Frequency.h"
+#include "Units/Mass.h"
+#include "Units/Stiffness.h"
+
+namespace eng {
+
+  using MassMatrix = Eigen::Matrix<Mass, Eigen::Dynamic, Eigen::Dynamic>;
+  using StiffnessMatrix = Eigen::Matrix<Stiffness, Eigen::Dynamic, Eigen::Dynamic>;
+  using SparseMassMatrix = Eigen::SparseMatrix<Mass>;
+  using SparseStiffnessMatrix = Eigen::SparseMatrix<Stiffness>;
+
+  /**
+   * \class ModalResults The natural frequencies of a system in increasing
+   *   order, and the mode shape of each as a column, normalized so that
+   *   phi^T M phi = 1. The frequencies are sqrt(k/m), in the same units as
+   *   natural_frequency.
+   */
+  struct ModalResults {
+    std::vector<Frequency> frequencies;
+    Eigen::MatrixXd shapes;
+
+    std::size_t size() const { return frequencies.size(); }
+  };
+
+  /**
+   * \class ModalAnalysis Solves K phi = w^2 M phi for the modes of a system
+   *    nearest a shift, with block Lanczos iteration on (K - s M)^-1 M.
+   *
+   *    The matrices are held as sparse matrices, and the sparsity pattern of
+   *    K - s M is analyzed once. The factorization of K - s M is kept, so
+   *    solving again at the same shift reuses it, and solving at a new shift
+   *    only repeats the numeric factorization. The blocks find repeated
+   *    frequencies of symmetric structures up to a multiplicity of four.
+   */
+  class ModalAnalysis {
+  public:
+    /**
+     * \brief ModalAnalysis constructor for dense matrices
+     *
+     * \param M The symmetric positive definite mass matrix
+     * \param K The symmetric positive semi-definite stiffness matrix
+     */
+    ModalAnalysis(const MassMatrix& M, const StiffnessMatrix& K);
+    /**
+     * \brief ModalAnalysis constructor for sparse matrices
+     *
+     * \param M The symmetric positive definite mass matrix
+     * \param K The symmetric positive semi-definite stiffness matrix
+     */
+    ModalAnalysis(const SparseMassMatrix& M, const SparseStiffnessMatrix& K);
+
+    /* The number of degrees of freedom */
+    std::size_t size() const { return static_cast<std::size_t>(_M.rows()); }
+
+    /**
+     * \brief Find the lowest modes of the system
+     *
+     * \param modes The number of modes to find
+     * \param results The frequencies and mode shapes found
+     * \param tolerance The relative residual every mode must converge to
+     * \return If every mode converged. The modes found so far are returned
+     *   either way.
+     */
+    bool solve(const std::size_t& modes, ModalResults& results,
+               const double& tolerance = 1e-6);
+    /**
+     * \brief Find the modes of the system nearest a frequency
+     *
+     * \param modes The number of modes to find
+     * \param shift The frequency to search around, in the units of the
+     *   results
+     * \param results The frequencies and mode shapes found
+     * \param tolerance The relative residual every mode must converge to
+     * \return If every mode converged. The modes found so far are returned
+     *   either way.
+     */
+    bool solve(const std::size_t& modes, const Frequency& shift, ModalResults& results,
+               const double& tolerance = 1e-6);
+
+  private:
+    void initialize();
+    bool factorize(const double& sigma);
+    bool lanczos(const std::size_t& modes, const double& sigma, ModalResults& results,
+                 const double& tolerance);
+
+    Eigen::SparseMatrix<double> _M;
+    Eigen::SparseMatrix<double> _K;
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> _solver;
+    double _rigid_shift;      /**< A small negative shift for when K is singular */
+    double _sigma;            /**< The shift of the current factorization */
+    double _factor_shift;     /**< The shift factored, moved off any natural frequency */
+    bool _factored;
+  };
+
+};  // namespace eng
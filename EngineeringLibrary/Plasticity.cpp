@@ -0,0 +1,121 @@
+#include "pch.h"
+#include "Plasticity.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace eng {
+
+  namespace {
+    // Iterations of Newton's method to find the plastic multiplier, and the
+    //   tolerance on the yield function relative to the yield stress squared
+    const int max_iterations = 25;
+    const double tolerance = 1e-12;
+  };
+
+  void PlasticPointArray::resize(const std::size_t& n) {
+    stress.resize(n);
+    plastic_x.resize(n);
+    plastic_y.resize(n);
+    plastic_xy.resize(n);
+    equivalent.resize(n);
+  }
+
+  PlaneStressPlasticity::PlaneStressPlasticity(const Material& material,
+                                               const double& ultimate_strain) :
+    _E(material.E().Pa()),
+    _nu(material.nu()),
+    _G(material.E().Pa()/(2*(1 + material.nu()))),
+    _yield(material.Sy().Pa()),
+    _tensile(std::max(material.St().Pa(), material.Sy().Pa())),
+    _hardening(ultimate_strain > 0 ? (_tensile - _yield)/ultimate_strain : 0) { }
+
+  Stress PlaneStressPlasticity::yield_stress(const double& equivalent) const {
+    return Stress(std::min(_yield + _hardening*equivalent, _tensile));
+  }
+
+  std::optional<std::size_t> PlaneStressPlasticity::update(const StrainElement3Array& increment,
+                                                           PlasticPointArray& state) const {
+    if (increment.size() != state.size()) {
+      return std::nullopt;
+    }
+    const std::size_t n = state.size();
+    const double plane = _E/(1 - _nu*_nu);
+    const double bulk = _E/(3*(1 - _nu));     // E/(3(1 - nu)) scales sigma_x + sigma_y
+    const double shear = 2*_G;                 // 2G scales sigma_y - sigma_x and tau_xy
+    const double saturation = _hardening > 0 ? (_tensile - _yield)/_hardening : 0;
+
+    const double* dex = increment.epsilon_x.data();
+    const double* dey = increment.epsilon_y.data();
+    const double* dgxy = increment.gamma_xy.data();
+    double* sx = state.stress.sigma_x.data();
+    double* sy = state.stress.sigma_y.data();
+    double* txy = state.stress.tau_xy.data();
+    double* px = state.plastic_x.data();
+    double* py = state.plastic_y.data();
+    double* pxy = state.plastic_xy.data();
+    double* alpha = state.equivalent.data();
+
+    std::size_t yielded = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      // elastic trial stress
+      const double trial_x = sx[i] + plane*(dex[i] + _nu*dey[i]);
+      const double trial_y = sy[i] + plane*(dey[i] + _nu*dex[i]);
+      const double trial_xy = txy[i] + _G*dgxy[i];
+
+      // In the eigenbasis of the plane stress projection the return only
+      //   scales a1 = sx + sy, and a2 = sy - sx and a3 = txy, by separate
+      //   factors. xi is 2/3 of the von Mises stress squared.
+      const double a1 = trial_x + trial_y;
+      const double a2 = trial_y - trial_x;
+      const double a3 = trial_xy;
+      const double a1_2 = a1*a1/6;
+      const double a23_2 = a2*a2/2 + 2*a3*a3;
+      const double yield_n = std::min(_yield + _hardening*alpha[i], _tensile);
+      if (a1_2 + a23_2 <= 2*yield_n*yield_n/3) {
+        sx[i] = trial_x;
+        sy[i] = trial_y;
+        txy[i] = trial_xy;
+        continue;
+      }
+
+      // Newton's method on the plastic multiplier for the yield condition
+      //   xi/2 - Sy^2/3 = 0, where both xi and Sy depend on it
+      double gamma = 0;
+      double applied = 0;
+      double f1 = 1;
+      double f2 = 1;
+      double equivalent = alpha[i];
+      for (int k = 0; k != max_iterations; ++k) {
+        applied = gamma;
+        f1 = 1/(1 + bulk*gamma);
+        f2 = 1/(1 + shear*gamma);
+        const double xi = a1_2*f1*f1 + a23_2*f2*f2;
+        const double root = std::sqrt(2*xi/3);
+        equivalent = alpha[i] + gamma*root;
+        const double hardening = equivalent < saturation ? _hardening : 0;
+        const double yield = std::min(_yield + _hardening*equivalent, _tensile);
+        const double phi = xi/2 - yield*yield/3;
+        if (std::fabs(phi) <= tolerance*yield*yield) {
+          break;
+        }
+        const double dxi = -2*bulk*a1_2*f1*f1*f1 - 2*shear*a23_2*f2*f2*f2;
+        const double dequivalent = root + (root > 0 ? gamma*dxi/(3*root) : 0);
+        gamma -= phi/(dxi/2 - 2*yield*hardening*dequivalent/3);
+      }
+
+      const double s1 = a1*f1;
+      const double s2 = a2*f2;
+      sx[i] = (s1 - s2)/2;
+      sy[i] = (s1 + s2)/2;
+      txy[i] = a3*f2;
+      px[i] += applied*(2*sx[i] - sy[i])/3;
+      py[i] += applied*(2*sy[i] - sx[i])/3;
+      pxy[i] += 2*applied*txy[i];
+      alpha[i] = equivalent;
+      ++yielded;
+    }
+    return yielded;
+  }
+
+};  // namespace eng
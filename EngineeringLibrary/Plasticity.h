@@ -0,0 +1,88 @@
+#pragma once
+
+/*****************************************************************//**
+ * \file  Plasticity.h
+ * \brief Elastic-plastic stress updates of material points in plane stress
+ *          with von Mises (J2) plasticity and linear isotropic hardening
+ *
+ * \author bltan
+ * \date   October 2026
+ *********************************************************************/
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "Material.h"
+#include "Strain.h"
+#include "Stress.h"
+
+namespace eng {
+
+  /**
+   * \class PlasticPointArray The state of many material points in plane
+   *   stress stored as parallel arrays: the stress in Pa, the plastic
+   *   strains, and the equivalent plastic strain which sets the hardening
+   */
+  struct PlasticPointArray {
+    StressElement2Array stress;
+
+    std::vector<double> plastic_x;
+    std::vector<double> plastic_y;
+    std::vector<double> plastic_xy;   /**< The engineering plastic shear strain */
+    std::vector<double> equivalent;   /**< The equivalent plastic strain */
+
+    std::size_t size() const { return equivalent.size(); }
+    /* Resize the arrays, with any new points unstressed and undeformed */
+    void resize(const std::size_t& n);
+  };
+
+  /**
+   * \class PlaneStressPlasticity Integrates the stress of material points in
+   *    plane stress over strain increments with the plane stress return
+   *    mapping of Simo and Taylor.
+   *
+   *    The yield stress hardens linearly with the equivalent plastic strain
+   *    from the yield strength to the tensile strength, then stays at the
+   *    tensile strength. Updates work in place on the arrays they are given
+   *    and never allocate, so one state can be stepped through a whole
+   *    analysis.
+   */
+  class PlaneStressPlasticity {
+  public:
+    /**
+     * \brief PlaneStressPlasticity constructor
+     *
+     * \param material The material, whose Young's modulus, Poisson's ratio,
+     *   yield strength and tensile strength are used
+     * \param ultimate_strain The equivalent plastic strain at which the
+     *   tensile strength is reached
+     */
+    PlaneStressPlasticity(const Material& material, const double& ultimate_strain);
+
+    /* The yield stress after an equivalent plastic strain */
+    Stress yield_stress(const double& equivalent) const;
+
+    /**
+     * \brief Update the state of every point over one strain increment
+     *
+     * \param increment The increment of total strain at each point. Only the
+     *   in-plane strains x, y and xy are used, since the strain through the
+     *   thickness follows from the stress being planar.
+     * \param state The state of each point, which is updated in place and
+     *   must have the same size as the increment
+     * \return The number of points which yielded during the increment, or
+     *   nothing, with the state unchanged, if the sizes differ
+     */
+    std::optional<std::size_t> update(const StrainElement3Array& increment, PlasticPointArray& state) const;
+
+  private:
+    double _E;
+    double _nu;
+    double _G;
+    double _yield;
+    double _tensile;
+    double _hardening;        /**< The hardening modulus, dSy/d(equivalent) */
+  };
+
+};  // namespace eng
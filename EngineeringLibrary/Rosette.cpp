@@ -0,0 +1,160 @@
+#include "pch.h"
+#include "Rosette.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <eigen3/Eigen/Dense>
+
+namespace eng {
+
+  void RosetteResults::resize(const std::size_t& n) {
+    epsilon_1.resize(n);
+    epsilon_2.resize(n);
+    angle.resize(n);
+    sigma_1.resize(n);
+    sigma_2.resize(n);
+  }
+
+  // The standard layouts always have three separate gauge lines
+  Rosette::Rosette(const Layout& layout) :
+    Rosette(*gauges(0_deg, layout == Layout::RECTANGULAR ? 45_deg : 60_deg,
+                    layout == Layout::RECTANGULAR ? 90_deg : 120_deg)) { }
+
+  std::optional<Rosette> Rosette::gauges(const Angle& a, const Angle& b, const Angle& c) {
+    const double angles[3] = {a.rad(), b.rad(), c.rad()};
+    // A gauge reads the same at any angle 180 degrees from its own, so two
+    //   gauges on one line give the same row twice
+    for (int i = 0; i != 3; ++i) {
+      const double apart = std::remainder(angles[i] - angles[(i + 1) % 3], pi);
+      if (std::abs(apart) < 1e-9) {
+        return std::nullopt;
+      }
+    }
+
+    // each gauge reads epsilon_x cos^2 + epsilon_y sin^2 + gamma_xy sin cos
+    Eigen::Matrix3d transformation;
+    for (int i = 0; i != 3; ++i) {
+      const double cosine = std::cos(angles[i]);
+      const double sine = std::sin(angles[i]);
+      transformation.row(i) << cosine*cosine, sine*sine, sine*cosine;
+    }
+    const Eigen::FullPivLU<Eigen::Matrix3d> lu(transformation);
+    if (!lu.isInvertible()) {
+      return std::nullopt;
+    }
+    const Eigen::Matrix3d inverse = lu.inverse();
+    Rosette rosette;
+    for (int i = 0; i != 3; ++i) {
+      for (int j = 0; j != 3; ++j) {
+        rosette._inverse[i][j] = inverse(i, j);
+      }
+    }
+    return rosette;
+  }
+
+  void Rosette::strain(const double& a, const double& b, const double& c,
+                       NormalStrain& normal, ShearStrain& shear) const {
+    normal = NormalStrain(_inverse[0][0]*a + _inverse[0][1]*b + _inverse[0][2]*c,
+                          _inverse[1][0]*a + _inverse[1][1]*b + _inverse[1][2]*c);
+    shear = ShearStrain(Angle(_inverse[2][0]*a + _inverse[2][1]*b + _inverse[2][2]*c));
+  }
+
+  NormalStrain Rosette::principal_strain(const double& a, const double& b,
+                                         const double& c) const {
+    NormalStrain normal;
+    ShearStrain shear;
+    strain(a, b, c, normal, shear);
+    const double center = (normal.epsilon_x + normal.epsilon_y)/2;
+    const double radius = std::hypot((normal.epsilon_x - normal.epsilon_y)/2,
+                                     shear.gamma_xy.rad()/2);
+    return NormalStrain(center + radius, center - radius);
+  }
+
+  PrincipalStress2 Rosette::principal_stress(const double& a, const double& b, const double& c,
+                                             const MaterialBase& material) const {
+    const NormalStrain principal = principal_strain(a, b, c);
+    const double nu = material.nu();
+    const Stress modulus = material.plane_stress_modulus();
+    return PrincipalStress2(modulus*(principal.epsilon_x + nu*principal.epsilon_y),
+                            modulus*(principal.epsilon_y + nu*principal.epsilon_x));
+  }
+
+  void Rosette::reduce(const double* a, const double* b, const double* c,
+                       const std::size_t& count, const MaterialBase& material,
+                       RosetteResults& results) const {
+    results.resize(count);
+    reduce_range(a, b, c, 0, count, material, results);
+  }
+
+  void Rosette::reduce(const double* a, const double* b, const double* c,
+                       const std::size_t& count, const MaterialBase& material,
+                       RosetteResults& results, const unsigned& threads,
+                       const std::size_t& chunk) const {
+    results.resize(count);
+    const std::size_t size = chunk > 0 ? chunk : count;
+    const std::size_t chunks = size > 0 ? (count + size - 1)/size : 0;
+    unsigned workers = threads > 0 ? threads : std::max(1u, std::thread::hardware_concurrency());
+    workers = static_cast<unsigned>(std::min<std::size_t>(workers, chunks));
+    if (workers <= 1) {
+      reduce_range(a, b, c, 0, count, material, results);
+      return;
+    }
+
+    // Workers take the next chunk until none are left, so a slow thread
+    //   does not hold up the rest
+    std::atomic<std::size_t> next(0);
+    auto work = [&]() {
+      for (std::size_t i = next++; i < chunks; i = next++) {
+        reduce_range(a, b, c, i*size, std::min(count, (i + 1)*size), material, results);
+      }
+    };
+    std::vector<std::thread> pool;
+    pool.reserve(workers - 1);
+    for (unsigned i = 1; i < workers; ++i) {
+      pool.emplace_back(work);
+    }
+    work();
+    for (auto& thread : pool) {
+      thread.join();
+    }
+  }
+
+  void Rosette::reduce_range(const double* a, const double* b, const double* c,
+                             const std::size_t& begin, const std::size_t& end,
+                             const MaterialBase& material, RosetteResults& results) const {
+    const double x0 = _inverse[0][0], x1 = _inverse[0][1], x2 = _inverse[0][2];
+    const double y0 = _inverse[1][0], y1 = _inverse[1][1], y2 = _inverse[1][2];
+    const double g0 = _inverse[2][0], g1 = _inverse[2][1], g2 = _inverse[2][2];
+    const double nu = material.nu();
+    const double modulus = material.plane_stress_modulus().Pa();
+
+    double* e1 = results.epsilon_1.data();
+    double* e2 = results.epsilon_2.data();
+    double* s1 = results.sigma_1.data();
+    double* s2 = results.sigma_2.data();
+    double* angle = results.angle.data();
+    for (std::size_t i = begin; i < end; ++i) {
+      const double ex = x0*a[i] + x1*b[i] + x2*c[i];
+      const double ey = y0*a[i] + y1*b[i] + y2*c[i];
+      const double gxy = g0*a[i] + g1*b[i] + g2*c[i];
+      const double center = (ex + ey)/2;
+      const double half_difference = (ex - ey)/2;
+      const double radius = std::sqrt(half_difference*half_difference + gxy*gxy/4);
+      e1[i] = center + radius;
+      e2[i] = center - radius;
+      s1[i] = modulus*(e1[i] + nu*e2[i]);
+      s2[i] = modulus*(e2[i] + nu*e1[i]);
+    }
+    // The angles are kept out of the loop above, since atan2 stops it from
+    //   being vectorized
+    for (std::size_t i = begin; i < end; ++i) {
+      const double ex = x0*a[i] + x1*b[i] + x2*c[i];
+      const double ey = y0*a[i] + y1*b[i] + y2*c[i];
+      const double gxy = g0*a[i] + g1*b[i] + g2*c[i];
+      angle[i] = std::atan2(gxy, ex - ey)/2;
+    }
+  }
+
+};  // namespace eng
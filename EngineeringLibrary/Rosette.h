@@ -0,0 +1,120 @@
+#pragma once
+
+/*****************************************************************//**
+ * \file  Rosette.h
+ * \brief Reduction of three element strain gauge rosette readings to
+ *          principal strains and stresses, for single samples and for
+ *          long chunked recordings
+ *
+ * \author bltan
+ * \date   October 2026
+ *********************************************************************/
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "Material.h"
+#include "Strain.h"
+#include "Stress.h"
+
+#include "Units/Angle.h"
+
+namespace eng {
+
+  /**
+   * \class RosetteResults The principal strains, the angle of the first
+   *   principal strain from gauge a, and the principal stresses in Pa of
+   *   many samples stored as parallel arrays
+   */
+  struct RosetteResults {
+    std::vector<double> epsilon_1;
+    std::vector<double> epsilon_2;
+    std::vector<double> angle;
+    std::vector<double> sigma_1;
+    std::vector<double> sigma_2;
+
+    std::size_t size() const { return epsilon_1.size(); }
+    void resize(const std::size_t& n);
+  };
+
+  /**
+   * \class Rosette A three element strain gauge rosette on a surface in plane
+   *    stress. The x axis is along gauge a, and the inverse of the strain
+   *    transformation of the three gauges is computed once at construction.
+   */
+  class Rosette {
+  public:
+    enum class Layout : unsigned char {
+      RECTANGULAR,    /**< Gauges at 0, 45 and 90 degrees */
+      DELTA,          /**< Gauges at 0, 60 and 120 degrees */
+    };
+
+    /**
+     * \brief Rosette constructor for a standard layout
+     *
+     * \param layout The angles of the gauges
+     */
+    Rosette(const Layout& layout);
+    /**
+     * \brief Create a rosette with gauges at any three angles
+     *
+     * \param a, b, c The angle of each gauge counterclockwise from the x axis
+     * \return The rosette, or nothing if two of the gauges lie along the same
+     *   line, such as at 0 and 180 degrees, so the three readings cannot be
+     *   told apart
+     */
+    static std::optional<Rosette> gauges(const Angle& a, const Angle& b, const Angle& c);
+
+    /* Calculate the strains in the x-y axes from the three gauge readings */
+    void strain(const double& a, const double& b, const double& c,
+                NormalStrain& normal, ShearStrain& shear) const;
+    /* Calculate the principal strains from the three gauge readings, where
+     * epsilon_1 >= epsilon_2 and epsilon_z is left at zero */
+    NormalStrain principal_strain(const double& a, const double& b, const double& c) const;
+    /* Calculate the principal stresses from the three gauge readings */
+    PrincipalStress2 principal_stress(const double& a, const double& b, const double& c,
+                                      const MaterialBase& material) const;
+
+    /**
+     * \brief Reduce many samples of the three gauges at once
+     *
+     * \param a, b, c The readings of each gauge, each holding count samples
+     * \param count The number of samples
+     * \param material The material the rosette is bonded to
+     * \param results The principal strains and stresses of each sample
+     */
+    void reduce(const double* a, const double* b, const double* c, const std::size_t& count,
+                const MaterialBase& material, RosetteResults& results) const;
+
+    /**
+     * \brief Reduce many samples of the three gauges in chunks shared across
+     *   worker threads. Every sample is independent, so the results are the
+     *   same as reducing the samples on one thread.
+     *
+     * \param a, b, c The readings of each gauge, each holding count samples
+     * \param count The number of samples
+     * \param material The material the rosette is bonded to
+     * \param results The principal strains and stresses of each sample
+     * \param threads The number of worker threads, where 0 uses one per
+     *   hardware thread
+     * \param chunk The number of samples each worker takes at a time
+     */
+    void reduce(const double* a, const double* b, const double* c, const std::size_t& count,
+                const MaterialBase& material, RosetteResults& results,
+                const unsigned& threads, const std::size_t& chunk = 16384) const;
+
+  private:
+    Rosette() = default;
+
+    /* Reduce the samples in [begin, end) into results, which is already sized */
+    void reduce_range(const double* a, const double* b, const double* c,
+                      const std::size_t& begin, const std::size_t& end,
+                      const MaterialBase& material, RosetteResults& results) const;
+
+    /* The rows of the inverse transformation from the gauge readings to
+     * epsilon_x, epsilon_y and gamma_xy */
+    double _inverse[3][3];
+  };
+
+};  // namespace eng
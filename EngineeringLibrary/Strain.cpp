@@ -14,8 +14,34 @@ namespace eng {
     gamma_xz(xz),
     gamma_yz(yz) { }
 
+  void StrainElement3Array::resize(const std::size_t& n) {
+    epsilon_x.resize(n);
+    epsilon_y.resize(n);
+    epsilon_z.resize(n);
+    gamma_xy.resize(n);
+    gamma_xz.resize(n);
+    gamma_yz.resize(n);
+  }
+
+  void StrainElement3Array::push_back(const NormalStrain& normal, const ShearStrain& shear) {
+    epsilon_x.push_back(normal.epsilon_x);
+    epsilon_y.push_back(normal.epsilon_y);
+    epsilon_z.push_back(normal.epsilon_z);
+    gamma_xy.push_back(shear.gamma_xy.rad());
+    gamma_xz.push_back(shear.gamma_xz.rad());
+    gamma_yz.push_back(shear.gamma_yz.rad());
+  }
+
+  NormalStrain StrainElement3Array::normal(const std::size_t& i) const {
+    return NormalStrain(epsilon_x[i], epsilon_y[i], epsilon_z[i]);
+  }
+
+  ShearStrain StrainElement3Array::shear(const std::size_t& i) const {
+    return ShearStrain(Angle(gamma_xy[i]), Angle(gamma_xz[i]), Angle(gamma_yz[i]));
+  }
+
   double hookes_law(const Material& material, const Stress& stress) {
-    return stress / material.E();
+    return stress.Pa()*material.inverse_E();
   }
 
   NormalStrain hookes_law(const Material& material, const StressElement2& stress) {
@@ -23,12 +49,11 @@ namespace eng {
   }
 
   NormalStrain hookes_law(const Material& material, const StressElement3& stress) {
-    NormalStrain ret;
-    ret.epsilon_x = (stress.sigma_x - material.nu()*(stress.sigma_y + stress.sigma_z))/material.E();
-    ret.epsilon_y = (stress.sigma_y - material.nu()*(stress.sigma_x + stress.sigma_z))/material.E();
-    ret.epsilon_z = (stress.sigma_z - material.nu()*(stress.sigma_x + stress.sigma_y))/material.E();
-
-    return ret;
+    const double sx = stress.sigma_x.Pa(), sy = stress.sigma_y.Pa(), sz = stress.sigma_z.Pa();
+    const double nu = material.nu();
+    const double compliance = material.inverse_E();
+    return NormalStrain((sx - nu*(sy + sz))*compliance, (sy - nu*(sx + sz))*compliance,
+                        (sz - nu*(sx + sy))*compliance);
   }
 
   ShearStrain hookes_law_shear(const Material& material, const StressElement2& stress) {
@@ -37,11 +62,35 @@ namespace eng {
   }
 
   ShearStrain hookes_law_shear(const Material& material, const StressElement3& stress) {
-    ShearStrain ret;
-    ret.gamma_xy = Angle(stress.tau_xy / material.G());
-    ret.gamma_xz = Angle(stress.tau_xz / material.G());
-    ret.gamma_yz = Angle(stress.tau_yz / material.G());
-    return ret;
+    const double compliance = material.inverse_G();
+    return ShearStrain(Angle(stress.tau_xy.Pa()*compliance), Angle(stress.tau_xz.Pa()*compliance),
+                       Angle(stress.tau_yz.Pa()*compliance));
+  }
+
+  bool hookes_law(const MaterialPropertyArray& materials, const std::vector<MaterialHandle>& handles,
+                  const StressElement3Array& stress, StrainElement3Array& strain) {
+    const std::size_t n = stress.size();
+    if (!materials.contains(handles, n)) {
+      strain.resize(0);
+      return false;
+    }
+    strain.resize(n);
+    const double* inverse_E = materials.inverse_E.data();
+    const double* inverse_G = materials.inverse_G.data();
+    const double* nu = materials.nu.data();
+    for (std::size_t i = 0; i < n; ++i) {
+      const MaterialHandle m = handles[i];
+      const double compliance = inverse_E[m];
+      const double sx = stress.sigma_x[i], sy = stress.sigma_y[i], sz = stress.sigma_z[i];
+      strain.epsilon_x[i] = (sx - nu[m]*(sy + sz))*compliance;
+      strain.epsilon_y[i] = (sy - nu[m]*(sx + sz))*compliance;
+      strain.epsilon_z[i] = (sz - nu[m]*(sx + sy))*compliance;
+      const double shear_compliance = inverse_G[m];
+      strain.gamma_xy[i] = stress.tau_xy[i]*shear_compliance;
+      strain.gamma_xz[i] = stress.tau_xz[i]*shear_compliance;
+      strain.gamma_yz[i] = stress.tau_yz[i]*shear_compliance;
+    }
+    return true;
   }
 
 };  // namespace eng
@@ -8,7 +8,11 @@
  * \date   August 2020
  *********************************************************************/
 
+#include <cstddef>
+#include <vector>
+
 #include "Material.h"
+#include "MaterialRegistry.h"
 #include "Stress.h"
 
 #include "Units/Angle.h"
@@ -50,6 +54,27 @@ namespace eng {
     ShearStrain(const Angle& xy = 0_rad, const Angle& xz = 0_rad, const Angle& yz = 0_rad);
   };
 
+  /**
+   * \class StrainElement3Array The normal and engineering shear strains of
+   *   many 3D elements stored as parallel arrays, for processing large
+   *   numbers of points at once
+   */
+  struct StrainElement3Array {
+    std::vector<double> epsilon_x;
+    std::vector<double> epsilon_y;
+    std::vector<double> epsilon_z;
+
+    std::vector<double> gamma_xy;
+    std::vector<double> gamma_xz;
+    std::vector<double> gamma_yz;
+
+    std::size_t size() const { return epsilon_x.size(); }
+    void resize(const std::size_t& n);
+    void push_back(const NormalStrain& normal, const ShearStrain& shear);
+    NormalStrain normal(const std::size_t& i) const;
+    ShearStrain shear(const std::size_t& i) const;
+  };
+
   /* Hooke's Law to determine strain from stress for a material alone a single axis */
   double hookes_law(const Material& material, const Stress& stress);
   /* Hooke's Law to determine strain from stress for a material loaded in planar stress */
@@ -63,6 +88,12 @@ namespace eng {
   ShearStrain hookes_law_shear(const Material& material, const StressElement2& stress);
   /* Hooke's Law for shear stress. */
   ShearStrain hookes_law_shear(const Material& material, const StressElement3& stress);
+  /* Hooke's Law for the normal and shear strains of many 3D stress elements,
+   * where each element has the material of its handle in the properties.
+   * Returns false with the strains emptied if there is not one handle per
+   * element, or a handle is not in the properties. */
+  bool hookes_law(const MaterialPropertyArray& materials, const std::vector<MaterialHandle>& handles,
+                  const StressElement3Array& stress, StrainElement3Array& strain);
 
 
 };  // namespace eng
@@ -1,6 +1,7 @@
 #include "pch.h"
 
 #include <algorithm>
+#include <cmath>
 #include <eigen3/Eigen/Dense>
 
 #include "Stress.h"
@@ -36,6 +37,55 @@ namespace eng {
     sigma_2(s2),
     sigma_3(s3) { }
 
+  void StressElement2Array::resize(const std::size_t& n) {
+    sigma_x.resize(n);
+    sigma_y.resize(n);
+    tau_xy.resize(n);
+  }
+
+  void StressElement2Array::push_back(const StressElement2& s) {
+    sigma_x.push_back(s.sigma_x.Pa());
+    sigma_y.push_back(s.sigma_y.Pa());
+    tau_xy.push_back(s.tau_xy.Pa());
+  }
+
+  StressElement2 StressElement2Array::operator[](const std::size_t& i) const {
+    return StressElement2(Stress(sigma_x[i]), Stress(sigma_y[i]), Stress(tau_xy[i]));
+  }
+
+  void StressElement3Array::resize(const std::size_t& n) {
+    sigma_x.resize(n);
+    sigma_y.resize(n);
+    sigma_z.resize(n);
+    tau_xy.resize(n);
+    tau_xz.resize(n);
+    tau_yz.resize(n);
+  }
+
+  void StressElement3Array::push_back(const StressElement3& s) {
+    sigma_x.push_back(s.sigma_x.Pa());
+    sigma_y.push_back(s.sigma_y.Pa());
+    sigma_z.push_back(s.sigma_z.Pa());
+    tau_xy.push_back(s.tau_xy.Pa());
+    tau_xz.push_back(s.tau_xz.Pa());
+    tau_yz.push_back(s.tau_yz.Pa());
+  }
+
+  StressElement3 StressElement3Array::operator[](const std::size_t& i) const {
+    return StressElement3(Stress(sigma_x[i]), Stress(sigma_y[i]), Stress(sigma_z[i]),
+                          Stress(tau_xy[i]), Stress(tau_xz[i]), Stress(tau_yz[i]));
+  }
+
+  void PrincipalStress3Array::resize(const std::size_t& n) {
+    sigma_1.resize(n);
+    sigma_2.resize(n);
+    sigma_3.resize(n);
+  }
+
+  PrincipalStress3 PrincipalStress3Array::operator[](const std::size_t& i) const {
+    return PrincipalStress3(Stress(sigma_1[i]), Stress(sigma_2[i]), Stress(sigma_3[i]));
+  }
+
   PrincipalStress2 principal_stress(const StressElement2& s) {
     PrincipalStress2 ret;
     ret.sigma_1 = (s.sigma_x + s.sigma_y)/2 
@@ -47,26 +97,42 @@ namespace eng {
   }
 
   PrincipalStress3 principal_stress(const StressElement3& s) {
+    double s1, s2, s3;
+    internal::principal_values(s.sigma_x.Pa(), s.sigma_y.Pa(), s.sigma_z.Pa(),
+                               s.tau_xy.Pa(), s.tau_xz.Pa(), s.tau_yz.Pa(), s1, s2, s3);
+    return PrincipalStress3(Stress(s1), Stress(s2), Stress(s3));
+  }
+
+  PrincipalStress3 principal_stress(const StressElement3& s, Eigen::Matrix3d& directions) {
     // create a stress tensor with the stress element
     Eigen::Matrix3d tensor;
     tensor << s.sigma_x.Pa(), s.tau_xy.Pa(), s.tau_xz.Pa(),
               s.tau_xy.Pa(), s.sigma_y.Pa(), s.tau_yz.Pa(),
               s.tau_xz.Pa(), s.tau_yz.Pa(), s.sigma_z.Pa();
 
-    // calculate the eigenvalues of the stress tensor
-    auto eig = tensor.eigenvalues();
-    Pressure s_a = Stress(eig(0).real());
-    Pressure s_b = Stress(eig(1).real());
-    Pressure s_c = Stress(eig(2).real());
-
-    // Sort the principal stresses by size
-    PrincipalStress3 ret;
-    ret.sigma_1 = s_a > s_b ? (s_a > s_c ? s_a : s_c) : (s_b > s_c ? s_b : s_c);
-    ret.sigma_2 = s_a > s_b ? (s_c > s_a ? s_a : (s_b > s_c ? s_b : s_c)) : 
-      (s_c > s_b ? s_b : (s_a > s_c ? s_a : s_c));
-    ret.sigma_3 = s_a > s_b ? (s_b > s_c ? s_c : s_b) : (s_a > s_c ? s_c : s_a);
-    
-    return ret;
+    // the closed form solver for symmetric 3x3 matrices sorts in increasing order
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
+    solver.computeDirect(tensor);
+    directions = solver.eigenvectors().rowwise().reverse();
+    const auto& values = solver.eigenvalues();
+    return PrincipalStress3(Stress(values(2)), Stress(values(1)), Stress(values(0)));
+  }
+
+  void principal_stress(const StressElement3Array& s, PrincipalStress3Array& principal) {
+    const std::size_t n = s.size();
+    principal.resize(n);
+    const double* sx = s.sigma_x.data();
+    const double* sy = s.sigma_y.data();
+    const double* sz = s.sigma_z.data();
+    const double* txy = s.tau_xy.data();
+    const double* txz = s.tau_xz.data();
+    const double* tyz = s.tau_yz.data();
+    double* s1 = principal.sigma_1.data();
+    double* s2 = principal.sigma_2.data();
+    double* s3 = principal.sigma_3.data();
+    for (std::size_t i = 0; i < n; ++i) {
+      internal::principal_values(sx[i], sy[i], sz[i], txy[i], txz[i], tyz[i], s1[i], s2[i], s3[i]);
+    }
   }
 
   PrincipalStress3  principal_stress(const Length& a, const Length& b, const Length& r,
@@ -99,8 +165,8 @@ namespace eng {
   Length  press_fit_interference(const Length& ri,
     const Length& R, const Length& ro, const Pressure& p,
     const MaterialBase& out_material, const MaterialBase& in_material) {  
-    return (p/out_material.E())*R*((ro*ro + R*R)/(ro*ro - R*R) + out_material.nu())
-      + (p/in_material.E())*R*((ri*ri + R*R)/(R*R - ri*ri) - in_material.nu());
+    return R*(p.Pa()*out_material.inverse_E())*((ro*ro + R*R)/(ro*ro - R*R) + out_material.nu())
+      + R*(p.Pa()*in_material.inverse_E())*((ri*ri + R*R)/(R*R - ri*ri) - in_material.nu());
   }
 
 }; // namespace eng
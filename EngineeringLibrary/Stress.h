@@ -9,6 +9,10 @@
  * \date   August 2020
  *********************************************************************/
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
 #include <eigen3/Eigen/Dense>
 
 #include "Material.h"
@@ -104,11 +108,94 @@ namespace eng {
     PrincipalStress3(const Stress& s1 = 0_Pa, const Stress& s2 = 0_Pa, const Stress& s3 = 0_Pa);
   };
 
+  /**
+   * \class StressElement2Array Many 2D stress elements stored as parallel
+   *   arrays of stress in Pa, for processing large numbers of points at once
+   */
+  struct StressElement2Array {
+    std::vector<double> sigma_x;
+    std::vector<double> sigma_y;
+
+    std::vector<double> tau_xy;
+
+    std::size_t size() const { return sigma_x.size(); }
+    void resize(const std::size_t& n);
+    void push_back(const StressElement2& s);
+    StressElement2 operator[](const std::size_t& i) const;
+  };
+
+  /**
+   * \class StressElement3Array Many 3D stress elements stored as parallel
+   *   arrays of stress in Pa, for processing large numbers of points at once
+   */
+  struct StressElement3Array {
+    std::vector<double> sigma_x;
+    std::vector<double> sigma_y;
+    std::vector<double> sigma_z;
+
+    std::vector<double> tau_xy;
+    std::vector<double> tau_xz;
+    std::vector<double> tau_yz;
+
+    std::size_t size() const { return sigma_x.size(); }
+    void resize(const std::size_t& n);
+    void push_back(const StressElement3& s);
+    StressElement3 operator[](const std::size_t& i) const;
+  };
+
+  /**
+   * \class PrincipalStress3Array The principal stresses of many 3D stress
+   *   elements stored as parallel arrays of stress in Pa
+   */
+  struct PrincipalStress3Array {
+    std::vector<double> sigma_1;
+    std::vector<double> sigma_2;
+    std::vector<double> sigma_3;
+
+    std::size_t size() const { return sigma_1.size(); }
+    void resize(const std::size_t& n);
+    PrincipalStress3 operator[](const std::size_t& i) const;
+  };
+
+
+  namespace internal {
+    /* The eigenvalues of a symmetric 3x3 tensor with the trigonometric form 
+     *   of Cardano's formula. The roots of the characteristic equation of the
+     *   deviatoric tensor are 2*p*cos(phi + 2*pi*k/3), which come out already
+     *   sorted, so there are no branches for the compiler to work around. */
+    inline void principal_values(const double& sx, const double& sy, const double& sz,
+                                 const double& txy, const double& txz, const double& tyz,
+                                 double& s1, double& s2, double& s3) {
+      const double mean = (sx + sy + sz)/3;
+      const double a = sx - mean;
+      const double b = sy - mean;
+      const double c = sz - mean;
+      const double shear = txy*txy + txz*txz + tyz*tyz;
+
+      // p is the root mean square of the deviatoric tensor's eigenvalues
+      const double p = std::sqrt((a*a + b*b + c*c + 2*shear)/6);
+      const double det = a*b*c + 2*txy*txz*tyz - a*tyz*tyz - b*txz*txz - c*txy*txy;
+      const double r = p > 0 ? det/(2*p*p*p) : 0;
+      const double phi = std::acos(std::min(1.0, std::max(-1.0, r)))/3;
+
+      s1 = mean + 2*p*std::cos(phi);
+      s3 = mean + 2*p*std::cos(phi + 2*static_cast<double>(pi)/3);
+      // the middle value from the trace, kept in order against rounding
+      s2 = std::min(s1, std::max(s3, 3*mean - s1 - s3));
+    }
+  };  // namespace internal
+
 
   /* Calculate ths principal stresses of a planar stress state */
   PrincipalStress2 principal_stress(const StressElement2& s);
   /* Calculate the principal stresses of a general 3D stress state */
   PrincipalStress3 principal_stress(const StressElement3& s);
+  /* Calculate the principal stresses of a general 3D stress state, and the
+   * directions they act in as the columns of directions in the order
+   * sigma_1, sigma_2, sigma_3 */
+  PrincipalStress3 principal_stress(const StressElement3& s, Eigen::Matrix3d& directions);
+  /* Calculate the principal stresses of many 3D stress states */
+  void principal_stress(const StressElement3Array& s, PrincipalStress3Array& principal);
   /* Calculate the principal stresses in a Cylindrical pressure vessel. */
   PrincipalStress3 principal_stress(const Length& a, const Length& b,
                                     const Length& r, const Force& F, const Pressure& Pi,
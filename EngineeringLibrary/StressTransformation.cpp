@@ -0,0 +1,173 @@
+#include "pch.h"
+#include "StressTransformation.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace eng {
+
+  MohrCircle::MohrCircle(const Stress& c, const Stress& r, const Angle& p) :
+    center(c),
+    radius(r),
+    phase(p) { }
+
+  Stress MohrCircle::normal_stress(const Angle& theta) const {
+    return center + radius*std::cos(2*theta.rad() - phase.rad());
+  }
+
+  Stress MohrCircle::shear_stress(const Angle& theta) const {
+    return -radius*std::sin(2*theta.rad() - phase.rad());
+  }
+
+  PlaneStress::PlaneStress(const Stress& n, const Stress& s) :
+    normal(n),
+    shear(s) { }
+
+  StressElement2 rotate(const StressElement2& s, const Angle& theta) {
+    const double c = std::cos(2*theta.rad());
+    const double n = std::sin(2*theta.rad());
+    const Stress average = (s.sigma_x + s.sigma_y)/2;
+    const Stress half_difference = (s.sigma_x - s.sigma_y)/2;
+    return StressElement2(average + half_difference*c + s.tau_xy*n,
+                          average - half_difference*c - s.tau_xy*n,
+                          s.tau_xy*c - half_difference*n);
+  }
+
+  StressElement3 rotate(const StressElement3& s, const Eigen::Matrix3d& rotation) {
+    Eigen::Matrix3d tensor;
+    tensor << s.sigma_x.Pa(), s.tau_xy.Pa(), s.tau_xz.Pa(),
+              s.tau_xy.Pa(), s.sigma_y.Pa(), s.tau_yz.Pa(),
+              s.tau_xz.Pa(), s.tau_yz.Pa(), s.sigma_z.Pa();
+    const Eigen::Matrix3d rotated = rotation*tensor*rotation.transpose();
+    return StressElement3(Stress(rotated(0, 0)), Stress(rotated(1, 1)), Stress(rotated(2, 2)),
+                          Stress(rotated(0, 1)), Stress(rotated(0, 2)), Stress(rotated(1, 2)));
+  }
+
+  MohrCircle mohr_circle(const StressElement2& s) {
+    const double half_difference = (s.sigma_x - s.sigma_y).Pa()/2;
+    return MohrCircle((s.sigma_x + s.sigma_y)/2,
+                      Stress(std::hypot(half_difference, s.tau_xy.Pa())),
+                      Angle(std::atan2(s.tau_xy.Pa(), half_difference)));
+  }
+
+  std::array<MohrCircle, 3> mohr_circles(const PrincipalStress3& s) {
+    return {MohrCircle((s.sigma_1 + s.sigma_3)/2, (s.sigma_1 - s.sigma_3)/2),
+            MohrCircle((s.sigma_1 + s.sigma_2)/2, (s.sigma_1 - s.sigma_2)/2),
+            MohrCircle((s.sigma_2 + s.sigma_3)/2, (s.sigma_2 - s.sigma_3)/2)};
+  }
+
+  PlaneStress plane_stress(const StressElement3& s, const Eigen::Vector3d& normal) {
+    // the traction on the plane, split into its normal and tangential parts
+    const double tx = s.sigma_x.Pa()*normal.x() + s.tau_xy.Pa()*normal.y() + s.tau_xz.Pa()*normal.z();
+    const double ty = s.tau_xy.Pa()*normal.x() + s.sigma_y.Pa()*normal.y() + s.tau_yz.Pa()*normal.z();
+    const double tz = s.tau_xz.Pa()*normal.x() + s.tau_yz.Pa()*normal.y() + s.sigma_z.Pa()*normal.z();
+    const double n = tx*normal.x() + ty*normal.y() + tz*normal.z();
+    return PlaneStress(Stress(n), Stress(std::sqrt(std::max(tx*tx + ty*ty + tz*tz - n*n, 0.0))));
+  }
+
+  /*
+   * RotationTable2
+   */
+
+  RotationTable2::RotationTable2(const std::vector<Angle>& thetas) {
+    _thetas.reserve(thetas.size());
+    _cos2.reserve(thetas.size());
+    _sin2.reserve(thetas.size());
+    for (const auto& theta : thetas) {
+      _thetas.push_back(theta.rad());
+      _cos2.push_back(std::cos(2*theta.rad()));
+      _sin2.push_back(std::sin(2*theta.rad()));
+    }
+  }
+
+  RotationTable2::RotationTable2(const Angle& start, const Angle& stop, const std::size_t& count) {
+    const double step = count > 1 ? (stop - start).rad()/(count - 1) : 0;
+    _thetas.reserve(count);
+    _cos2.reserve(count);
+    _sin2.reserve(count);
+    for (std::size_t i = 0; i != count; ++i) {
+      const double theta = start.rad() + step*i;
+      _thetas.push_back(theta);
+      _cos2.push_back(std::cos(2*theta));
+      _sin2.push_back(std::sin(2*theta));
+    }
+  }
+
+  void RotationTable2::rotate(const StressElement2& s, StressElement2Array& rotated) const {
+    const std::size_t n = size();
+    rotated.resize(n);
+    const double average = (s.sigma_x + s.sigma_y).Pa()/2;
+    const double half_difference = (s.sigma_x - s.sigma_y).Pa()/2;
+    const double tau = s.tau_xy.Pa();
+    const double* c = _cos2.data();
+    const double* sn = _sin2.data();
+    double* sx = rotated.sigma_x.data();
+    double* sy = rotated.sigma_y.data();
+    double* txy = rotated.tau_xy.data();
+    for (std::size_t i = 0; i < n; ++i) {
+      const double swing = half_difference*c[i] + tau*sn[i];
+      sx[i] = average + swing;
+      sy[i] = average - swing;
+      txy[i] = tau*c[i] - half_difference*sn[i];
+    }
+  }
+
+  /*
+   * PlaneTable3
+   */
+
+  PlaneTable3::PlaneTable3(const std::vector<Eigen::Vector3d>& normals) {
+    for (const auto& n : normals) {
+      add(n);
+    }
+  }
+
+  PlaneTable3::PlaneTable3(const std::size_t& polar, const std::size_t& azimuth) {
+    // the pole is shared by every azimuth, so it is only added once
+    add(Eigen::Vector3d(0, 0, 1));
+    const double half_pi = static_cast<double>(pi)/2;
+    for (std::size_t i = 1; i <= polar; ++i) {
+      const double theta = half_pi*i/polar;
+      // a normal on the equator and the one opposite it are the same plane,
+      //   so with an even number of divisions only half of them are added
+      const std::size_t count = (i == polar && azimuth % 2 == 0) ? azimuth/2 : azimuth;
+      for (std::size_t j = 0; j != count; ++j) {
+        const double phi = 4*half_pi*j/azimuth;
+        add(Eigen::Vector3d(std::sin(theta)*std::cos(phi), std::sin(theta)*std::sin(phi),
+                            std::cos(theta)));
+      }
+    }
+  }
+
+  Eigen::Vector3d PlaneTable3::normal(const std::size_t& i) const {
+    return Eigen::Vector3d(_nx[i], _ny[i], _nz[i]);
+  }
+
+  void PlaneTable3::add(const Eigen::Vector3d& n) {
+    _nx.push_back(n.x());
+    _ny.push_back(n.y());
+    _nz.push_back(n.z());
+  }
+
+  std::size_t PlaneTable3::plane_stress(const StressElement3& s, std::vector<double>& normal,
+                                        std::vector<double>& shear) const {
+    const std::size_t count = size();
+    normal.resize(count);
+    shear.resize(count);
+    const double sx = s.sigma_x.Pa(), sy = s.sigma_y.Pa(), sz = s.sigma_z.Pa();
+    const double txy = s.tau_xy.Pa(), txz = s.tau_xz.Pa(), tyz = s.tau_yz.Pa();
+    const double* nx = _nx.data();
+    const double* ny = _ny.data();
+    const double* nz = _nz.data();
+    for (std::size_t i = 0; i < count; ++i) {
+      const double tx = sx*nx[i] + txy*ny[i] + txz*nz[i];
+      const double ty = txy*nx[i] + sy*ny[i] + tyz*nz[i];
+      const double tz = txz*nx[i] + tyz*ny[i] + sz*nz[i];
+      const double n = tx*nx[i] + ty*ny[i] + tz*nz[i];
+      normal[i] = n;
+      shear[i] = std::sqrt(std::max(tx*tx + ty*ty + tz*tz - n*n, 0.0));
+    }
+    return count == 0 ? 0 : std::max_element(shear.begin(), shear.end()) - shear.begin();
+  }
+
+};  // namespace eng
@@ -0,0 +1,150 @@
+#pragma once
+
+/*****************************************************************//**
+ * \file  StressTransformation.h
+ * \brief Transformation of stress elements to rotated axes, Mohr's circle,
+ *          and the stresses on many planes for critical plane searches
+ *
+ * \author bltan
+ * \date   October 2026
+ *********************************************************************/
+
+#include <array>
+#include <cstddef>
+#include <vector>
+#include <eigen3/Eigen/Dense>
+
+#include "Stress.h"
+
+#include "Units/Angle.h"
+
+namespace eng {
+
+  /**
+   * \class MohrCircle The center and radius of a Mohr's circle. The stresses
+   *    on a plane rotated by theta lie at the angle 2*theta around the circle
+   *    from the x face.
+   */
+  struct MohrCircle {
+    Stress center;
+    Stress radius;
+    Angle phase;      /**< The angle 2*theta of the x face around the circle */
+
+    /**
+     * \brief MohrCircle constructor
+     *
+     * \param c The normal stress at the center of the circle
+     * \param r The radius of the circle, which is the maximum shear stress
+     * \param p The angle of the x face around the circle
+     */
+    MohrCircle(const Stress& c = 0_Pa, const Stress& r = 0_Pa, const Angle& p = 0_rad);
+
+    /* The normal stress on the face rotated by theta from the x face */
+    Stress normal_stress(const Angle& theta) const;
+    /* The shear stress on the face rotated by theta from the x face */
+    Stress shear_stress(const Angle& theta) const;
+  };
+
+  /**
+   * \class PlaneStress The normal and shear stress acting on a plane
+   */
+  struct PlaneStress {
+    Stress normal;
+    Stress shear;
+
+    /**
+     * \brief PlaneStress constructor
+     *
+     * \param n The normal stress on the plane
+     * \param s The magnitude of the shear stress on the plane
+     */
+    PlaneStress(const Stress& n = 0_Pa, const Stress& s = 0_Pa);
+  };
+
+  /* Transform a planar stress state to axes rotated counterclockwise by theta */
+  StressElement2 rotate(const StressElement2& s, const Angle& theta);
+  /* Transform a 3D stress state to rotated axes. The rows of the rotation
+   * are the new axes written in the old axes, so sigma' = R sigma R^T */
+  StressElement3 rotate(const StressElement3& s, const Eigen::Matrix3d& rotation);
+
+  /* Calculate Mohr's circle of a planar stress state */
+  MohrCircle mohr_circle(const StressElement2& s);
+  /* Calculate the three Mohr's circles of a 3D stress state, between
+   * sigma_1 and sigma_3, sigma_1 and sigma_2, and sigma_2 and sigma_3 */
+  std::array<MohrCircle, 3> mohr_circles(const PrincipalStress3& s);
+
+  /* Calculate the normal and shear stress on the plane with a unit normal */
+  PlaneStress plane_stress(const StressElement3& s, const Eigen::Vector3d& normal);
+
+  /**
+   * \class RotationTable2 A set of planar rotations with their sines and
+   *    cosines computed once, to transform stress states to all of them.
+   */
+  class RotationTable2 {
+  public:
+    /**
+     * \brief RotationTable2 constructor
+     *
+     * \param thetas The angles of the rotations
+     */
+    RotationTable2(const std::vector<Angle>& thetas);
+    /**
+     * \brief RotationTable2 constructor for evenly spaced rotations
+     *
+     * \param start The first angle
+     * \param stop The last angle
+     * \param count The number of angles
+     */
+    RotationTable2(const Angle& start, const Angle& stop, const std::size_t& count);
+
+    std::size_t size() const { return _cos2.size(); }
+    Angle angle(const std::size_t& i) const { return Angle(_thetas[i]); }
+
+    /* Transform a planar stress state to every rotation in the table */
+    void rotate(const StressElement2& s, StressElement2Array& rotated) const;
+
+  private:
+    std::vector<double> _thetas;
+    std::vector<double> _cos2;
+    std::vector<double> _sin2;
+  };
+
+  /**
+   * \class PlaneTable3 A set of planes with the products of their normals
+   *    computed once, to find the normal and shear stress on all of them.
+   */
+  class PlaneTable3 {
+  public:
+    /**
+     * \brief PlaneTable3 constructor
+     *
+     * \param normals The unit normals of the planes
+     */
+    PlaneTable3(const std::vector<Eigen::Vector3d>& normals);
+    /**
+     * \brief PlaneTable3 constructor for the planes with normals on a grid
+     *   over the upper hemisphere. Every plane through a point has a normal on
+     *   this hemisphere, and each plane is in the table once.
+     *
+     * \param polar The number of divisions of the angle from the z axis
+     * \param azimuth The number of divisions of the angle around the z axis
+     */
+    PlaneTable3(const std::size_t& polar, const std::size_t& azimuth);
+
+    std::size_t size() const { return _nx.size(); }
+    Eigen::Vector3d normal(const std::size_t& i) const;
+
+    /* Calculate the normal and shear stress in Pa on every plane in the table,
+     * and return the index of the plane with the largest shear stress */
+    std::size_t plane_stress(const StressElement3& s, std::vector<double>& normal,
+                             std::vector<double>& shear) const;
+
+  private:
+    void add(const Eigen::Vector3d& n);
+
+    std::vector<double> _nx;
+    std::vector<double> _ny;
+    std::vector<double> _nz;
+  };
+
+};  // namespace eng
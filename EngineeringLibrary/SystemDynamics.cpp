@@ -5,6 +5,40 @@
 #include "SystemDynamics.h"
 
 namespace eng {
+
+  namespace {
+
+    /* The response of one system to a sweep, where the ratios r = w/wn are
+     *   formed by multiplying by 1/wn so the loop has no divisions other
+     *   than the reciprocal square root of the magnitude */
+    void sweep_response(const double& natural_frequency, const double& damping_ratio,
+                        const std::vector<Frequency>& frequencies, double* magnitude,
+                        double* phase) {
+      const std::size_t n = frequencies.size();
+      const double inverse = 1/natural_frequency;
+      const double two_zeta = 2*damping_ratio;
+      const Frequency* w = frequencies.data();
+      for (std::size_t i = 0; i < n; ++i) {
+        const double r = w[i].value()*inverse;
+        const double real = 1 - r*r;
+        const double imaginary = two_zeta*r;
+        magnitude[i] = 1/std::sqrt(real*real + imaginary*imaginary);
+      }
+      // The phase is kept out of the loop above, since atan2 stops it from
+      //   being vectorized
+      for (std::size_t i = 0; i < n; ++i) {
+        const double r = w[i].value()*inverse;
+        phase[i] = -std::atan2(two_zeta*r, 1 - r*r);
+      }
+    }
+
+  };
+
+  void FrequencyResponse::resize(const std::size_t& n) {
+    magnitude.resize(n);
+    phase.resize(n);
+  }
+
   Frequency natural_frequency(Mass mass, Damping damping, Stiffness stiffness) {
     return sqrt(stiffness/mass);
   }
@@ -26,4 +60,64 @@ namespace eng {
     return 1 / (2*damping_ratio * std::sqrt(1 - damping_ratio*damping_ratio));
   }
 
+  void linear_sweep(Frequency start, Frequency stop, std::size_t count,
+                    std::vector<Frequency>& frequencies) {
+    frequencies.resize(count);
+    const double step = count > 1 ? (stop - start).value()/(count - 1) : 0;
+    for (std::size_t i = 0; i < count; ++i) {
+      frequencies[i] = Frequency(start.value() + step*i);
+    }
+    if (count > 1) {
+      // the last step may round short of or past the stop
+      frequencies[count - 1] = stop;
+    }
+  }
+
+  void log_sweep(Frequency start, Frequency stop, std::size_t count,
+                 std::vector<Frequency>& frequencies) {
+    frequencies.resize(count);
+    const double first = std::log(start.value());
+    const double step = count > 1 ? (std::log(stop.value()) - first)/(count - 1) : 0;
+    for (std::size_t i = 0; i < count; ++i) {
+      frequencies[i] = Frequency(std::exp(first + step*i));
+    }
+    if (count > 0) {
+      // exp(log(x)) is not always exactly x
+      frequencies[0] = start;
+    }
+    if (count > 1) {
+      frequencies[count - 1] = stop;
+    }
+  }
+
+  void frequency_response(Frequency natural_frequency, double damping_ratio,
+                          const std::vector<Frequency>& frequencies, FrequencyResponse& response) {
+    response.resize(frequencies.size());
+    sweep_response(natural_frequency.value(), damping_ratio, frequencies,
+                   response.magnitude.data(), response.phase.data());
+  }
+
+  void frequency_response(Mass mass, Damping damping, Stiffness stiffness,
+                          const std::vector<Frequency>& frequencies, FrequencyResponse& response) {
+    frequency_response(natural_frequency(mass, damping, stiffness),
+                       damping_ratio(mass, damping, stiffness), frequencies, response);
+  }
+
+  bool frequency_response(const std::vector<Frequency>& natural_frequencies,
+                          const std::vector<double>& damping_ratios,
+                          const std::vector<Frequency>& frequencies, FrequencyResponse& response) {
+    if (natural_frequencies.size() != damping_ratios.size()) {
+      response.resize(0);
+      return false;
+    }
+    const std::size_t systems = natural_frequencies.size();
+    const std::size_t points = frequencies.size();
+    response.resize(systems*points);
+    for (std::size_t i = 0; i < systems; ++i) {
+      sweep_response(natural_frequencies[i].value(), damping_ratios[i], frequencies,
+                     response.magnitude.data() + i*points, response.phase.data() + i*points);
+    }
+    return true;
+  }
+
 };  // namespace eng
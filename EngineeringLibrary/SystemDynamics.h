@@ -9,6 +9,9 @@
  * \date   August 2020
  *********************************************************************/
 
+#include <cstddef>
+#include <vector>
+
 #include "Units/Mass.h"
 #include "Units/Damping.h"
 #include "Units/Stiffness.h"
@@ -37,5 +40,53 @@ namespace eng {
    */
   double resonant_magnitude_ratio(Frequency natural_frequency, double damping_ratio);
 
+  /**
+   * \class FrequencyResponse The magnitude ratio and phase of a single
+   *   degree of freedom system at many excitation frequencies, stored as
+   *   parallel arrays. For several systems the sweep of each system follows
+   *   the one before.
+   */
+  struct FrequencyResponse {
+    std::vector<double> magnitude;    /**< The ratio of the amplitude to the static deflection F/k */
+    std::vector<double> phase;        /**< The lag of the response in rad, from 0 to -pi */
+
+    std::size_t size() const { return magnitude.size(); }
+    void resize(const std::size_t& n);
+  };
+
+  /**
+   * \brief Fill frequencies evenly spaced from start to stop, including both
+   */
+  void linear_sweep(Frequency start, Frequency stop, std::size_t count,
+                    std::vector<Frequency>& frequencies);
+  /**
+   * \brief Fill frequencies evenly spaced on a log scale from start to stop,
+   *   including both, as for a Bode plot
+   */
+  void log_sweep(Frequency start, Frequency stop, std::size_t count,
+                 std::vector<Frequency>& frequencies);
+
+  /**
+   * \brief Calculate the frequency response of a system at many excitation
+   *   frequencies, which are in the same units as the natural frequency
+   */
+  void frequency_response(Frequency natural_frequency, double damping_ratio,
+                          const std::vector<Frequency>& frequencies, FrequencyResponse& response);
+  /**
+   * \brief Calculate the frequency response of a system at many excitation
+   *   frequencies
+   */
+  void frequency_response(Mass mass, Damping damping, Stiffness stiffness,
+                          const std::vector<Frequency>& frequencies, FrequencyResponse& response);
+  /**
+   * \brief Calculate the frequency responses of many systems over the same
+   *   excitation frequencies, where the response of system i starts at
+   *   i*frequencies.size(). Returns false, with the response empty, unless
+   *   there is one damping ratio per natural frequency
+   */
+  bool frequency_response(const std::vector<Frequency>& natural_frequencies,
+                          const std::vector<double>& damping_ratios,
+                          const std::vector<Frequency>& frequencies, FrequencyResponse& response);
+
 };  // namespace eng
 
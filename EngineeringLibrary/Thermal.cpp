@@ -0,0 +1,175 @@
+#include "pch.h"
+#include "Thermal.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace eng {
+
+  namespace {
+    // The most buckets in the lookup table of a PropertyCurve
+    const std::size_t max_buckets = 4096;
+
+    // The number of other restrained directions whose Poisson contraction is
+    //   also prevented
+    double other_directions(const ThermalMaterial::Restraint& restraint) {
+      return restraint == ThermalMaterial::Restraint::UNIAXIAL ? 0 :
+             restraint == ThermalMaterial::Restraint::BIAXIAL ? 1 : 2;
+    }
+  };
+
+  /*
+   * PropertyCurve
+   */
+
+  PropertyCurve::PropertyCurve(const double& value) :
+    _T0(0),
+    _T1(0),
+    _bucket_scale(0),
+    _T{0},
+    _slope{0},
+    _intercept{value},
+    _bucket{0} { }
+
+  PropertyCurve::PropertyCurve(const std::vector<Temperature>& temperatures,
+                               const std::vector<double>& values) :
+    PropertyCurve(values.empty() ? 0 : values.front()) {
+    const std::size_t n = std::min(temperatures.size(), values.size());
+    if (n < 2) {
+      return;
+    }
+    // Temperatures out of order have no curve through them, so the property
+    //   is left constant at the first value
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+      if (!(temperatures[i + 1].value() >= temperatures[i].value())) {
+        return;
+      }
+    }
+
+    _T0 = temperatures.front().value();
+    _T1 = temperatures[n - 1].value();
+    _T.clear();
+    _slope.clear();
+    _intercept.clear();
+    double spacing = _T1 - _T0;
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+      const double Ta = temperatures[i].value();
+      const double Tb = temperatures[i + 1].value();
+      const double slope = Tb > Ta ? (values[i + 1] - values[i])/(Tb - Ta) : 0;
+      _T.push_back(Tb);
+      _slope.push_back(slope);
+      _intercept.push_back(values[i + 1] - slope*Tb);
+      if (Tb > Ta) {
+        spacing = std::min(spacing, Tb - Ta);
+      }
+    }
+    if (!(_T1 > _T0)) {
+      _T1 = _T0;
+      return;
+    }
+
+    // With buckets no wider than the closest pair of points, the segment at
+    //   the start of a bucket is at most one short of the right one
+    const std::size_t buckets = std::min(max_buckets,
+      static_cast<std::size_t>(std::ceil((_T1 - _T0)/spacing)));
+    _bucket_scale = buckets/(_T1 - _T0);
+    _bucket.resize(buckets + 1);
+    // Each bucket starts a little early so rounding in the lookup can never
+    //   land past the segment it starts from
+    const double early = 1e-9*(_T1 - _T0);
+    std::size_t segment = 0;
+    for (std::size_t k = 0; k <= buckets; ++k) {
+      const double T = _T0 + k/_bucket_scale - early;
+      while (segment + 1 < _T.size() && T > _T[segment]) {
+        ++segment;
+      }
+      _bucket[k] = static_cast<unsigned>(segment);
+    }
+  }
+
+  double PropertyCurve::at(const double& T) const {
+    const double t = std::min(std::max(T, _T0), _T1);
+    std::size_t i = _bucket[static_cast<std::size_t>((t - _T0)*_bucket_scale)];
+    while (t > _T[i]) {
+      ++i;
+    }
+    return _intercept[i] + _slope[i]*t;
+  }
+
+  void PropertyCurve::evaluate(const std::vector<Temperature>& T,
+                               std::vector<double>& values) const {
+    const std::size_t n = T.size();
+    values.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      values[i] = at(T[i].value());
+    }
+  }
+
+  /*
+   * ThermalMaterial
+   */
+
+  ThermalMaterial::ThermalMaterial(const PropertyCurve& E, const PropertyCurve& nu,
+                                   const PropertyCurve& alpha, const Temperature& reference) :
+    _E(E),
+    _nu(nu),
+    _alpha(alpha),
+    _reference(reference.value()),
+    _isotropic(true) { }
+
+  ThermalMaterial::ThermalMaterial(const MaterialBase& material, const ThermalExpansion& alpha,
+                                   const Temperature& reference) :
+    _E(material.E().Pa()),
+    _nu(material.nu()),
+    _G(material.G().Pa()),
+    _alpha(alpha.value()),
+    _reference(reference.value()),
+    _isotropic(false) { }
+
+  MaterialBase ThermalMaterial::at(const Temperature& T) const {
+    const double E = _E(T);
+    const double nu = _nu(T);
+    if (_isotropic) {
+      return MaterialBase(Stress(E), nu);
+    }
+    return MaterialBase(Stress(E), Stress(_G(T)), nu);
+  }
+
+  ThermalExpansion ThermalMaterial::alpha(const Temperature& T) const {
+    return ThermalExpansion(_alpha(T));
+  }
+
+  double ThermalMaterial::thermal_strain(const Temperature& T) const {
+    return _alpha(T)*(T.value() - _reference);
+  }
+
+  void ThermalMaterial::thermal_strain(const std::vector<Temperature>& T,
+                                       std::vector<double>& strain) const {
+    const std::size_t n = T.size();
+    strain.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      const double t = T[i].value();
+      strain[i] = _alpha.at(t)*(t - _reference);
+    }
+  }
+
+  Stress ThermalMaterial::thermal_stress(const Temperature& T, const Restraint& restraint) const {
+    const double t = T.value();
+    const double k = other_directions(restraint);
+    return Stress(-_E.at(t)*_alpha.at(t)*(t - _reference)/(1 - k*_nu.at(t)));
+  }
+
+  void ThermalMaterial::thermal_stress(const std::vector<Temperature>& T,
+                                       const Restraint& restraint,
+                                       std::vector<double>& stress) const {
+    // sigma = -E alpha dT/(1 - k nu)
+    const double k = other_directions(restraint);
+    const std::size_t n = T.size();
+    stress.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      const double t = T[i].value();
+      stress[i] = -_E.at(t)*_alpha.at(t)*(t - _reference)/(1 - k*_nu.at(t));
+    }
+  }
+
+};  // namespace eng
@@ -0,0 +1,134 @@
+#pragma once
+
+/*****************************************************************//**
+ * \file  Thermal.h
+ * \brief Temperature dependent material properties, thermal expansion, and
+ *          the strains and stresses caused by changes in temperature
+ *
+ * \author bltan
+ * \date   October 2026
+ *********************************************************************/
+
+#include <cstddef>
+#include <vector>
+
+#include "Material.h"
+
+#include "Units/Temperature.h"
+
+namespace eng {
+
+  /**
+   * \class PropertyCurve A material property tabulated against temperature
+   *    and interpolated linearly between the points, held constant beyond
+   *    the first and last points.
+   *
+   *    Each segment is stored as a slope and intercept, and a table of evenly
+   *    spaced buckets over the temperature range gives the first segment to
+   *    check, so a lookup is a multiply, a load and rarely a step to the next
+   *    segment instead of a search.
+   */
+  class PropertyCurve {
+  public:
+    /**
+     * \brief PropertyCurve constructor for a constant property
+     *
+     * \param value The value of the property in SI units
+     */
+    PropertyCurve(const double& value = 0);
+    /**
+     * \brief PropertyCurve constructor
+     *
+     * \param temperatures The temperatures of the points, in increasing order.
+     *   If they are not, the property is constant at the first value.
+     * \param values The value of the property in SI units at each temperature
+     */
+    PropertyCurve(const std::vector<Temperature>& temperatures,
+                  const std::vector<double>& values);
+
+    /* The value of the property at a temperature */
+    double operator()(const Temperature& T) const { return at(T.value()); }
+    /* The value of the property at a temperature in K */
+    double at(const double& T) const;
+    /* The value of the property at many temperatures */
+    void evaluate(const std::vector<Temperature>& T, std::vector<double>& values) const;
+
+  private:
+    double _T0;                     /**< The first temperature */
+    double _T1;                     /**< The last temperature */
+    double _bucket_scale;           /**< The number of buckets per K */
+    std::vector<double> _T;         /**< The temperature at the end of each segment */
+    std::vector<double> _slope;
+    std::vector<double> _intercept;
+    std::vector<unsigned> _bucket;  /**< The segment at the start of each bucket */
+  };
+
+  /**
+   * \class ThermalMaterial An isotropic material whose elastic properties
+   *    and thermal expansion change with temperature.
+   *
+   *    The thermal expansion is the secant coefficient from the reference
+   *    temperature, which is what handbooks tabulate, so the thermal strain at
+   *    T is alpha(T)*(T - reference).
+   */
+  class ThermalMaterial {
+  public:
+    /** How a body is held when it is heated, which sets the stress caused
+     *    by its thermal strain being prevented */
+    enum class Restraint : unsigned char {
+      UNIAXIAL,   /**< Held along one axis, such as a bar between walls */
+      BIAXIAL,    /**< Held in a plane, such as the surface of a plate */
+      TRIAXIAL,   /**< Held in every direction */
+    };
+
+    /**
+     * \brief ThermalMaterial constructor
+     *
+     * \param E Young's modulus in Pa against temperature
+     * \param nu Poisson's ratio against temperature
+     * \param alpha The secant coefficient of thermal expansion in 1/K
+     * \param reference The temperature at which there is no thermal strain
+     */
+    ThermalMaterial(const PropertyCurve& E, const PropertyCurve& nu,
+                    const PropertyCurve& alpha, const Temperature& reference = Celcius(20));
+    /**
+     * \brief ThermalMaterial constructor for constant properties, which
+     *   keeps the modulus of rigidity of the material as given
+     *
+     * \param material The elastic properties of the material
+     * \param alpha The coefficient of thermal expansion
+     * \param reference The temperature at which there is no thermal strain
+     */
+    ThermalMaterial(const MaterialBase& material, const ThermalExpansion& alpha,
+                    const Temperature& reference = Celcius(20));
+
+    Temperature reference() const { return Temperature(_reference); }
+
+    /* The elastic properties at a temperature. G is E/(2(1 + nu)) unless it
+     * was given with the material. */
+    MaterialBase at(const Temperature& T) const;
+    /* The coefficient of thermal expansion at a temperature */
+    ThermalExpansion alpha(const Temperature& T) const;
+
+    /* Calculate the free thermal strain at a temperature */
+    double thermal_strain(const Temperature& T) const;
+    /* Calculate the free thermal strain at many temperatures */
+    void thermal_strain(const std::vector<Temperature>& T, std::vector<double>& strain) const;
+
+    /* Calculate the stress in each restrained direction when the thermal
+     * strain at a temperature is fully prevented */
+    Stress thermal_stress(const Temperature& T, const Restraint& restraint) const;
+    /* Calculate the restrained thermal stress in Pa at many temperatures */
+    void thermal_stress(const std::vector<Temperature>& T, const Restraint& restraint,
+                        std::vector<double>& stress) const;
+
+  private:
+    PropertyCurve _E;
+    PropertyCurve _nu;
+    PropertyCurve _G;
+    PropertyCurve _alpha;
+    double _reference;
+    bool _isotropic;      /**< If G is found from E and nu */
+  };
+
+};  // namespace eng
@@ -0,0 +1,136 @@
+#include "pch.h"
+#include "ThickWalledCylinder.h"
+
+#include <algorithm>
+
+namespace eng {
+
+  void CylinderStressField::resize(const std::size_t& n) {
+    radius.resize(n);
+    radial.resize(n);
+    hoop.resize(n);
+    axial.resize(n);
+  }
+
+  PrincipalStress3 CylinderStressField::principal_stress(const std::size_t& i) const {
+    const double s1 = std::max({radial[i], hoop[i], axial[i]});
+    const double s3 = std::min({radial[i], hoop[i], axial[i]});
+    return PrincipalStress3(Stress(s1), Stress(radial[i] + hoop[i] + axial[i] - s1 - s3),
+                            Stress(s3));
+  }
+
+  /*
+   * ThickWalledCylinder
+   */
+
+  ThickWalledCylinder::ThickWalledCylinder(const Length& a, const Length& b) :
+    _a(a.value()),
+    _b(b.value()) {
+    const double wall = _b*_b - _a*_a;
+    _area = pi*wall;
+    _inner_fraction = _a*_a/wall;
+    _outer_fraction = _b*_b/wall;
+  }
+
+  void ThickWalledCylinder::field(const Pressure& Pi, const Pressure& Po, const Force& F,
+                                  const std::size_t& points, CylinderStressField& field,
+                                  const bool& closed_ends) const {
+    field.resize(points);
+    const double inside = Pi.Pa();
+    const double outside = Po.Pa();
+    const double average = inside*_inner_fraction - outside*_outer_fraction;
+    const double difference = inside - outside;
+    const double longitudinal = (closed_ends ? average : 0) + F.N()/_area;
+    const double step = points > 1 ? (_b - _a)/(points - 1) : 0;
+    for (std::size_t j = 0; j < points; ++j) {
+      const double r = _a + step*j;
+      const double k = _a > 0 ? _inner_fraction*_b*_b/(r*r) : 0;
+      field.radius[j] = r;
+      field.radial[j] = average - k*difference;
+      field.hoop[j] = average + k*difference;
+      field.axial[j] = longitudinal;
+    }
+  }
+
+  bool ThickWalledCylinder::field(const std::vector<Pressure>& Pi, const std::vector<Pressure>& Po,
+                                  const Force& F, const std::size_t& points,
+                                  CylinderStressField& field, const bool& closed_ends) const {
+    if (Pi.size() != Po.size()) {
+      field.resize(0);
+      return false;
+    }
+    const std::size_t cases = Pi.size();
+    field.resize(cases*points);
+    if (cases == 0) {
+      return true;
+    }
+
+    // The radial term a^2 b^2/((b^2 - a^2) r^2) only depends on the geometry,
+    //   so it is found once for the grid and reused by every case
+    std::vector<double> k(points);
+    const double step = points > 1 ? (_b - _a)/(points - 1) : 0;
+    for (std::size_t j = 0; j < points; ++j) {
+      const double r = _a + step*j;
+      field.radius[j] = r;
+      k[j] = _a > 0 ? _inner_fraction*_b*_b/(r*r) : 0;
+    }
+
+    const double end_caps = closed_ends ? 1.0 : 0.0;
+    const double axial_load = F.N()/_area;
+    for (std::size_t i = 0; i < cases; ++i) {
+      const double inside = Pi[i].Pa();
+      const double outside = Po[i].Pa();
+      const double average = inside*_inner_fraction - outside*_outer_fraction;
+      const double difference = inside - outside;
+      const double longitudinal = end_caps*average + axial_load;
+
+      double* radius = field.radius.data() + i*points;
+      double* radial = field.radial.data() + i*points;
+      double* hoop = field.hoop.data() + i*points;
+      double* axial = field.axial.data() + i*points;
+      for (std::size_t j = 0; j < points; ++j) {
+        radius[j] = field.radius[j];
+        radial[j] = average - k[j]*difference;
+        hoop[j] = average + k[j]*difference;
+        axial[j] = longitudinal;
+      }
+    }
+    return true;
+  }
+
+  /*
+   * PressFit
+   */
+
+  PressFit::PressFit(const Length& ri, const Length& R, const Length& ro,
+                     const MaterialBase& out_material, const MaterialBase& in_material) :
+    _inner(ri, R),
+    _outer(R, ro),
+    _compliance(press_fit_interference(ri, R, ro, 1_Pa, out_material, in_material).value()) { }
+
+  Length PressFit::interference(const Pressure& p) const {
+    return Length(_compliance*p.Pa());
+  }
+
+  Pressure PressFit::contact_pressure(const Length& interference) const {
+    return Pressure(interference.value()/_compliance);
+  }
+
+  void PressFit::contact_pressure(const std::vector<Length>& interference,
+                                  std::vector<double>& pressure) const {
+    const std::size_t n = interference.size();
+    pressure.resize(n);
+    const double stiffness = 1/_compliance;
+    for (std::size_t i = 0; i < n; ++i) {
+      pressure[i] = interference[i].value()*stiffness;
+    }
+  }
+
+  void PressFit::field(const Length& interference, const std::size_t& points,
+                       CylinderStressField& inner, CylinderStressField& outer) const {
+    const Pressure p = contact_pressure(interference);
+    _inner.field(0_Pa, p, 0_N, points, inner, false);
+    _outer.field(p, 0_Pa, 0_N, points, outer, false);
+  }
+
+};  // namespace eng
@@ -0,0 +1,144 @@
+#pragma once
+
+/*****************************************************************//**
+ * \file  ThickWalledCylinder.h
+ * \brief Lame stress fields in thick-walled cylinders and press fits
+ *
+ * \author bltan
+ * \date   October 2026
+ *********************************************************************/
+
+#include <cstddef>
+#include <vector>
+
+#include "Material.h"
+#include "Stress.h"
+
+#include "Units/Force.h"
+#include "Units/Length.h"
+
+namespace eng {
+
+  /**
+   * \class CylinderStressField The radial, hoop and axial stresses in Pa at
+   *    points through the wall of a cylinder, stored as parallel arrays. For
+   *    several load cases the points of each case follow each other.
+   */
+  struct CylinderStressField {
+    std::vector<double> radius;
+    std::vector<double> radial;
+    std::vector<double> hoop;
+    std::vector<double> axial;
+
+    std::size_t size() const { return radius.size(); }
+    void resize(const std::size_t& n);
+    /* The principal stresses at one point */
+    PrincipalStress3 principal_stress(const std::size_t& i) const;
+  };
+
+  /**
+   * \class ThickWalledCylinder A cylinder under internal and external
+   *    pressure, where the geometric terms of Lame's equations are computed
+   *    once for every evaluation of the stresses.
+   */
+  class ThickWalledCylinder {
+  public:
+    /**
+     * \brief ThickWalledCylinder constructor
+     *
+     * \param a The inner radius
+     * \param b The outer radius
+     */
+    ThickWalledCylinder(const Length& a, const Length& b);
+
+    Length inner_radius() const { return Length(_a); }
+    Length outer_radius() const { return Length(_b); }
+
+    /**
+     * \brief Calculate the stresses at evenly spaced radii through the wall
+     *
+     * \param Pi The internal pressure
+     * \param Po The external pressure
+     * \param F The axial force on the cylinder
+     * \param points The number of radii, including both surfaces
+     * \param field The stresses at each radius
+     * \param closed_ends If the ends are closed, the pressures on the end
+     *   caps add to the axial stress
+     */
+    void field(const Pressure& Pi, const Pressure& Po, const Force& F,
+               const std::size_t& points, CylinderStressField& field,
+               const bool& closed_ends = true) const;
+    /**
+     * \brief Calculate the stresses at evenly spaced radii through the wall
+     *   for many load cases in one pass
+     *
+     * \param Pi The internal pressure of each case
+     * \param Po The external pressure of each case, the same length as Pi
+     * \param F The axial force on the cylinder in every case
+     * \param points The number of radii, including both surfaces
+     * \param field The stresses at each radius of each case, case by case
+     * \param closed_ends If the ends are closed, the pressures on the end
+     *   caps add to the axial stress
+     * \return False, with an empty field, if Pi and Po differ in length
+     */
+    bool field(const std::vector<Pressure>& Pi, const std::vector<Pressure>& Po,
+               const Force& F, const std::size_t& points, CylinderStressField& field,
+               const bool& closed_ends = true) const;
+
+  private:
+    double _a;
+    double _b;
+    double _area;             /**< The area of the wall */
+    double _inner_fraction;   /**< a^2/(b^2 - a^2) */
+    double _outer_fraction;   /**< b^2/(b^2 - a^2) */
+  };
+
+  /**
+   * \class PressFit Two cylinders pressed together, where the compliance of
+   *    the fit is computed once to move between interference, contact
+   *    pressure and the stresses in both members.
+   */
+  class PressFit {
+  public:
+    /**
+     * \brief PressFit constructor
+     *
+     * \param ri The inner radius of the inner member, which is zero if solid
+     * \param R The nominal radius of the fit
+     * \param ro The outer radius of the outer member
+     * \param out_material The material of the outer member
+     * \param in_material The material of the inner member
+     */
+    PressFit(const Length& ri, const Length& R, const Length& ro,
+             const MaterialBase& out_material, const MaterialBase& in_material);
+
+    ThickWalledCylinder inner() const { return _inner; }
+    ThickWalledCylinder outer() const { return _outer; }
+
+    /* Calculate the radial interference which causes a contact pressure */
+    Length interference(const Pressure& p) const;
+    /* Calculate the contact pressure caused by a radial interference */
+    Pressure contact_pressure(const Length& interference) const;
+    /* Calculate the contact pressure in Pa of many radial interferences */
+    void contact_pressure(const std::vector<Length>& interference,
+                          std::vector<double>& pressure) const;
+
+    /**
+     * \brief Calculate the stresses through both members caused by an
+     *   interference, with no axial load
+     *
+     * \param interference The radial interference
+     * \param points The number of radii through each member
+     * \param inner The stresses in the inner member
+     * \param outer The stresses in the outer member
+     */
+    void field(const Length& interference, const std::size_t& points,
+               CylinderStressField& inner, CylinderStressField& outer) const;
+
+  private:
+    ThickWalledCylinder _inner;
+    ThickWalledCylinder _outer;
+    double _compliance;       /**< The interference per unit contact pressure */
+  };
+
+};  // namespace eng
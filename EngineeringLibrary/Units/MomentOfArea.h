@@ -40,6 +40,8 @@ namespace eng {
   };
 
   using SecondMomentOfArea = SIUnit<0, 4, 0, 0, 0, 0, 0>;
+  /** The warping constant of a section, in m^6 */
+  using WarpingConstant = SIUnit<0, 6, 0, 0, 0, 0, 0>;
 
   // Literal operators
   SecondMomentOfArea operator"" _mm4(long double val);
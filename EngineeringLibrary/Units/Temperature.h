@@ -32,6 +32,8 @@ namespace eng {
   };
 
   using Temperature = SIUnit<0, 0, 0, 0, 1, 0, 0>;
+  /** A coefficient of thermal expansion, in 1/K */
+  using ThermalExpansion = SIUnit<0, 0, 0, 0, -1, 0, 0>;
 
   Temperature operator"" _Kelvin(long double val);
   Temperature operator"" _Kelvin(unsigned long long val);
@@ -0,0 +1,386 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "UnitHelperFunctions.h"
+#include "EngineeringLibrary/Engineering.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace BoltTests {
+  TEST_CLASS(TestBolt) {
+    eng::Material steel{250_MPa, 400_MPa, eng::MaterialBase(207_GPa, 0.3)};
+    eng::Material cast_iron{150_MPa, 200_MPa, eng::MaterialBase(100_GPa, 0.26)};
+  public:
+    TEST_METHOD(MembersStiffness) {
+      // Shigley's Eq. (8-22) for two members of one material with dw = 1.5d,
+      //   km = 0.5774 pi E d/(2 ln(5 (0.5774 l + 0.5 d)/(0.5774 l + 2.5 d)))
+      std::vector<eng::joint_member> members{{steel, 20_mm}, {steel, 20_mm}};
+      Assert::AreEqual(2.2350681e9, eng::members_stiffness(members, 12_mm).value(), 1e3);
+      Assert::AreEqual(40_mm, eng::joint_thickness(members));
+
+      // splitting one member into two identical layers changes nothing
+      std::vector<eng::joint_member> layers{{steel, 10_mm}, {steel, 10_mm}, {steel, 20_mm}};
+      Assert::AreEqual(2.2350681e9, eng::members_stiffness(layers, 12_mm).value(), 1e3);
+
+      // a wider washer face stiffens the joint
+      Assert::AreEqual(3.9007573e9, eng::members_stiffness(members, 12_mm, 24_mm).value(), 1e3);
+    }
+    TEST_METHOD(MixedStack) {
+      // Shigley's Eq. (8-20) for each frustum, in series: the steel from the
+      //   top, the 5 mm of cast iron above the middle, and the 20 mm of cast
+      //   iron below it
+      std::vector<eng::joint_member> members{{steel, 15_mm}, {cast_iron, 25_mm}};
+      Assert::AreEqual(1.4045486e9, eng::members_stiffness(members, 12_mm).value(), 1e3);
+
+      // flipping the stack over gives the same stiffness
+      std::vector<eng::joint_member> flipped{{cast_iron, 25_mm}, {steel, 15_mm}};
+      Assert::AreEqual(1.4045486e9, eng::members_stiffness(flipped, 12_mm).value(), 1e3);
+    }
+    TEST_METHOD(Batch) {
+      eng::JointArray joints;
+      joints.push_back({{steel, 20_mm}, {steel, 20_mm}}, 12_mm);
+      joints.push_back({{steel, 15_mm}, {cast_iron, 25_mm}}, 12_mm);
+      joints.push_back({{steel, 20_mm}, {steel, 20_mm}}, 12_mm, 24_mm);
+      std::vector<double> stiffness;
+      eng::members_stiffness(joints, stiffness);
+
+      Assert::AreEqual(size_t(3), stiffness.size());
+      Assert::AreEqual(2.2350681e9, stiffness[0], 1e3);
+      Assert::AreEqual(1.4045486e9, stiffness[1], 1e3);
+      Assert::AreEqual(3.9007573e9, stiffness[2], 1e3);
+    }
+    TEST_METHOD(SplitMembers) {
+      std::vector<eng::joint_member> top, bottom;
+      std::vector<eng::joint_member> members{{steel, 15_mm}, {cast_iron, 25_mm}};
+      eng::split_members(members, top, bottom, eng::joint_thickness(members));
+      Assert::AreEqual(size_t(2), top.size());
+      Assert::AreEqual(size_t(1), bottom.size());
+      Assert::AreEqual(15_mm, top[0].thickness);
+      Assert::AreEqual(5_mm, top[1].thickness);
+      Assert::AreEqual(20_mm, bottom[0].thickness);
+    }
+    TEST_METHOD(SplitAtMiddle) {
+      // a face exactly on the middle splits no member
+      std::vector<eng::joint_member> top, bottom;
+      std::vector<eng::joint_member> members{{steel, 20_mm}, {cast_iron, 20_mm}};
+      eng::split_members(members, top, bottom, eng::joint_thickness(members));
+      Assert::AreEqual(size_t(1), top.size());
+      Assert::AreEqual(size_t(1), bottom.size());
+      Assert::AreEqual(100_GPa, bottom[0].material.E());
+
+      // 0.1 + 0.2 rounds above the middle of 0.6, which must not leave a
+      //   sliver of the last member in the top half
+      top.clear();
+      bottom.clear();
+      std::vector<eng::joint_member> rounded{{steel, 0.1_m}, {steel, 0.2_m}, {cast_iron, 0.3_m}};
+      eng::split_members(rounded, top, bottom, 0.6_m);
+      Assert::AreEqual(size_t(2), top.size());
+      Assert::AreEqual(size_t(1), bottom.size());
+      Assert::AreEqual(0.3_m, bottom[0].thickness);
+    }
+    TEST_METHOD(FactorsOfSafety) {
+      // Sp At = 100 kN, C = 0.25, P = 20 kN and Fi = 60 kN
+      const eng::Area At = 100_mm*100_mm/100;
+      Assert::AreEqual(1.5384615, eng::factor_of_safety_yield(1000_MPa, At, 0.25, 20_kN, 60_kN),
+                       1e-6);
+      Assert::AreEqual(8.0, eng::factor_of_safety_load(1000_MPa, At, 0.25, 20_kN, 60_kN), 1e-9);
+      Assert::AreEqual(4.0, eng::factor_of_safety_separation(60_kN, 20_kN, 0.25), 1e-9);
+    }
+  };
+  TEST_CLASS(TestBoltGroup) {
+    // four bolts 100 mm by 60 mm apart around (100, 100) mm, so each is
+    //   sqrt(50^2 + 30^2) mm from the centroid and J = 4 (50^2 + 30^2) mm^2.
+    //   Sp At = 60 kN, C = 0.25 and Fi = 40 kN.
+    eng::BoltGroup group{{eng::LengthVec(50_mm, 70_mm, 0_mm), eng::LengthVec(150_mm, 70_mm, 0_mm),
+                          eng::LengthVec(50_mm, 130_mm, 0_mm), eng::LengthVec(150_mm, 130_mm, 0_mm)},
+                         600_MPa, 100_mm*100_mm/100, 0.25, 40_kN};
+    eng::LengthVec centroid{100_mm, 100_mm, 0_mm};
+  public:
+    TEST_METHOD(Pattern) {
+      Assert::AreEqual(size_t(4), group.size());
+      Assert::AreEqual(centroid, group.centroid());
+      Assert::AreEqual(0.0136, group.polar_moment().value(), 1e-15);
+    }
+    TEST_METHOD(Direct) {
+      // 8 kN of shear and 20 kN of tension at the centroid, shared equally
+      eng::BoltGroupResults results;
+      const double n = group.solve(eng::AppliedLoad(0_N, -8_kN, 20_kN, centroid),
+                                   eng::AppliedMoment(), results);
+      Assert::AreEqual(size_t(4), results.size());
+      for (std::size_t i = 0; i != 4; ++i) {
+        Assert::AreEqual(2000.0, results.shear[i], 1e-6);
+        Assert::AreEqual(5000.0, results.tension[i], 1e-6);
+        // 60/(0.25*5 + 40), (60 - 40)/(0.25*5) and 40/(5*0.75)
+        Assert::AreEqual(1.4545455, results.yield[i], 1e-6);
+        Assert::AreEqual(16.0, results.load[i], 1e-9);
+        Assert::AreEqual(10.666667, results.separation[i], 1e-6);
+      }
+      Assert::AreEqual(1.4545455, n, 1e-6);
+    }
+    TEST_METHOD(Torsional) {
+      // 8 kN down 150 mm right of the centroid adds Mz = -1200 Nm, and each
+      //   bolt takes Mz r/J perpendicular to its offset on top of 2 kN direct
+      eng::BoltGroupResults results;
+      group.solve(eng::AppliedLoad(0_N, -8_kN, 0_N, eng::LengthVec(250_mm, 100_mm, 0_mm)),
+                  eng::AppliedMoment(), results);
+      Assert::AreEqual(3580.9956, results.shear[0], 1e-3);
+      Assert::AreEqual(6936.6885, results.shear[1], 1e-3);
+      Assert::AreEqual(3580.9956, results.shear[2], 1e-3);
+      Assert::AreEqual(6936.6885, results.shear[3], 1e-3);
+
+      // the same as applying the moment at the centroid
+      eng::BoltGroupResults moved;
+      group.solve(eng::AppliedLoad(0_N, -8_kN, 0_N, centroid),
+                  eng::AppliedMoment(0_Nm, 0_Nm, -1200_Nm), moved);
+      for (std::size_t i = 0; i != 4; ++i) {
+        Assert::AreEqual(results.shear[i], moved.shear[i], 1e-6);
+      }
+    }
+    TEST_METHOD(Bending) {
+      // Mx = 1000 Nm spreads as Mx dy/sum(dy^2) = +-8333 N over the rows,
+      //   on top of 5 kN of direct tension
+      eng::BoltGroupResults results;
+      const double n = group.solve(eng::AppliedLoad(0_N, 0_N, 20_kN, centroid),
+                                   eng::AppliedMoment(1000_Nm, 0_Nm, 0_Nm), results);
+      Assert::AreEqual(-3333.3333, results.tension[0], 1e-3);
+      Assert::AreEqual(-3333.3333, results.tension[1], 1e-3);
+      Assert::AreEqual(13333.333, results.tension[2], 1e-3);
+      Assert::AreEqual(13333.333, results.tension[3], 1e-3);
+
+      // the bolts in compression cannot separate
+      Assert::IsTrue(std::isinf(results.separation[0]));
+      Assert::IsTrue(std::isinf(results.load[0]));
+      // 60/(0.25*13.33 + 40), (60 - 40)/(0.25*13.33) and 40/(13.33*0.75)
+      Assert::AreEqual(1.3846154, results.yield[2], 1e-6);
+      Assert::AreEqual(6.0, results.load[2], 1e-6);
+      Assert::AreEqual(4.0, results.separation[2], 1e-6);
+      Assert::AreEqual(1.3846154, n, 1e-6);
+
+      // My = 500 Nm gives -My dx/sum(dx^2) = -+2500 N across the columns
+      group.solve(eng::AppliedLoad(centroid), eng::AppliedMoment(0_Nm, 500_Nm, 0_Nm), results);
+      Assert::AreEqual(2500.0, results.tension[0], 1e-6);
+      Assert::AreEqual(-2500.0, results.tension[1], 1e-6);
+    }
+    TEST_METHOD(Cases) {
+      std::vector<eng::AppliedLoad> loads{eng::AppliedLoad(0_N, -8_kN, 20_kN, centroid),
+                                          eng::AppliedLoad(0_N, 0_N, 20_kN, centroid)};
+      std::vector<eng::AppliedMoment> moments{eng::AppliedMoment(),
+                                              eng::AppliedMoment(1000_Nm, 0_Nm, 0_Nm)};
+      eng::BoltGroupResults results;
+      Assert::AreEqual(1.3846154, group.solve(loads, moments, results), 1e-6);
+      Assert::AreEqual(size_t(8), results.size());
+      Assert::AreEqual(5000.0, results.tension[0], 1e-6);
+      Assert::AreEqual(13333.333, results.tension[7], 1e-3);
+
+      // every load needs a moment
+      moments.pop_back();
+      Assert::IsTrue(std::isnan(group.solve(loads, moments, results)));
+      Assert::AreEqual(size_t(0), results.size());
+    }
+  };
+  TEST_CLASS(TestFastener) {
+    eng::Material steel{250_MPa, 400_MPa, eng::MaterialBase(207_GPa, 0.3)};
+    std::vector<eng::joint_member> members{{steel, 15_mm}, {steel, 15_mm}};
+
+    static bool dominates(const eng::BoltedJointSearch::Candidate& lh,
+                          const eng::BoltedJointSearch::Candidate& rh) {
+      return lh.size->At() <= rh.size->At() && lh.grade->Sp() <= rh.grade->Sp() &&
+        lh.factor() >= rh.factor() &&
+        (lh.size->At() < rh.size->At() || lh.grade->Sp() < rh.grade->Sp() ||
+         lh.factor() > rh.factor());
+    }
+  public:
+    TEST_METHOD(Catalog) {
+      const eng::BoltSize* m12 = eng::metric_bolts::find("M12");
+      Assert::IsNotNull(m12);
+      Assert::IsTrue(m12->designation() == "M12");
+      Assert::AreEqual(12_mm, m12->d());
+      Assert::AreEqual(1.75_mm, m12->pitch());
+      Assert::AreEqual(84.3e-6, m12->At().value(), 1e-12);
+      Assert::AreEqual(113.09734e-6, m12->Ad().value(), 1e-11);
+      // letter case is ignored
+      Assert::IsTrue(eng::metric_bolts::find("m12") == m12);
+      // spaces are ignored, as in the material and section catalogs
+      Assert::IsTrue(eng::metric_bolts::find("M 12") == m12);
+      Assert::IsNull(eng::metric_bolts::find("M13"));
+      Assert::IsNull(eng::metric_bolts::find("M1"));
+
+      const eng::BoltGrade* grade = eng::metric_bolts::find_grade("10.9");
+      Assert::IsNotNull(grade);
+      Assert::AreEqual(830_MPa, grade->Sp());
+      Assert::AreEqual(940_MPa, grade->Sy());
+      Assert::AreEqual(1040_MPa, grade->St());
+      Assert::IsNull(eng::metric_bolts::find_grade("10"));
+
+      // class 8.8 is only made from M16 up
+      Assert::IsFalse(eng::metric_bolts::find_grade("8.8")->available(*m12));
+      Assert::IsTrue(eng::metric_bolts::find_grade("8.8")->available(*eng::metric_bolts::find("M16")));
+
+      Assert::AreEqual(size_t(11), eng::metric_bolts::size());
+      Assert::AreEqual(size_t(7), eng::metric_bolts::grade_count());
+      Assert::IsTrue(eng::metric_bolts::end() - eng::metric_bolts::begin() == 11);
+      Assert::IsTrue(eng::metric_bolts::grades_end() - eng::metric_bolts::grades_begin() == 7);
+    }
+    TEST_METHOD(Evaluate) {
+      eng::BoltedJointSearch search(members);
+      eng::BoltedJointSearch::Batch batch;
+      search.candidates(batch);
+      search.evaluate(5_kN, batch);
+      Assert::IsTrue(batch.size() > 0);
+
+      // the batch gives the same factors of safety as the scalar functions
+      for (std::size_t i = 0; i != batch.size(); ++i) {
+        const eng::Stress Sp(batch.Sp[i]);
+        const eng::Area At(batch.At[i]);
+        const eng::Force Fi(batch.preload[i]);
+        Assert::IsTrue(batch.C[i] > 0 && batch.C[i] < 1);
+        Assert::AreEqual(eng::factor_of_safety_yield(Sp, At, batch.C[i], 5_kN, Fi),
+                         batch.yield[i], 1e-9);
+        Assert::AreEqual(eng::factor_of_safety_load(Sp, At, batch.C[i], 5_kN, Fi),
+                         batch.load[i], 1e-9);
+        Assert::AreEqual(eng::factor_of_safety_separation(Fi, 5_kN, batch.C[i]),
+                         batch.separation[i], 1e-9);
+      }
+    }
+    TEST_METHOD(KnownOptimum) {
+      // Without a load every factor of safety is infinite, so the smallest
+      //   and weakest bolt, an M5 of class 4.6, dominates every other
+      eng::BoltedJointSearch search(members);
+      const auto optimal = search.pareto(0_N);
+      Assert::AreEqual(size_t(1), optimal.size());
+      Assert::IsTrue(optimal[0].size->designation() == "M5");
+      Assert::IsTrue(optimal[0].grade->designation() == "4.6");
+
+      // one preload and a factor of safety nothing can reach
+      Assert::IsTrue(search.preloads({0.75}).require(1e9).pareto(5_kN).empty());
+    }
+    TEST_METHOD(Pareto) {
+      eng::BoltedJointSearch search(members);
+      search.require(2);
+      const auto optimal = search.pareto(20_kN);
+      Assert::IsTrue(optimal.size() > 1);
+
+      // rebuild every feasible candidate to check the set by brute force
+      eng::BoltedJointSearch::Batch batch;
+      search.candidates(batch);
+      search.evaluate(20_kN, batch);
+      std::vector<eng::BoltedJointSearch::Candidate> feasible;
+      for (std::size_t i = 0; i != batch.size(); ++i) {
+        eng::BoltedJointSearch::Candidate c{
+          eng::metric_bolts::begin() + batch.size_index[i],
+          eng::metric_bolts::grades_begin() + batch.grade_index[i],
+          eng::Force(batch.preload[i]), batch.C[i], batch.yield[i], batch.load[i],
+          batch.separation[i]};
+        if (c.yield >= 1 && c.factor() >= 2) {
+          feasible.push_back(c);
+        }
+      }
+
+      for (std::size_t i = 0; i != optimal.size(); ++i) {
+        Assert::IsTrue(optimal[i].yield >= 1);
+        Assert::IsTrue(optimal[i].factor() >= 2);
+        // sorted from the smallest stress area up
+        if (i > 0) {
+          Assert::IsTrue(optimal[i - 1].size->At() <= optimal[i].size->At());
+        }
+        // nothing feasible dominates an optimal candidate
+        for (const auto& c : feasible) {
+          Assert::IsFalse(dominates(c, optimal[i]));
+        }
+      }
+      // every feasible candidate is optimal or dominated by one that is
+      for (const auto& c : feasible) {
+        Assert::IsTrue(std::any_of(optimal.begin(), optimal.end(), [&](const auto& o) {
+          return o.size->At() <= c.size->At() && o.grade->Sp() <= c.grade->Sp() &&
+            o.factor() >= c.factor();
+        }));
+      }
+
+      // the largest tension of a group governs
+      const auto group = search.pareto(std::vector<double>{5e3, 20e3, -3e3});
+      Assert::AreEqual(optimal.size(), group.size());
+    }
+  };
+  TEST_CLASS(TestBoltReliability) {
+    // Sp At = 60 kN and C = 0.25. 48 Nm on an M10 with K = 0.2 gives a
+    //   preload of 24 kN
+    eng::PreloadMonteCarlo simulation() const {
+      eng::PreloadMonteCarlo mc(600_MPa, 100_mm*100_mm/100, 0.25);
+      mc.torque(48_Nm, 0_Nm).nut_factor(0.2, 0).diameter(10_mm, 0_m).load(30_kN, 2_kN);
+      return mc;
+    }
+  public:
+    TEST_METHOD(Histogram) {
+      eng::ScatterHistogram histogram;
+      for (int i = 1; i <= 100; ++i) {
+        histogram.add(i);
+      }
+      Assert::AreEqual(std::uint64_t(100), histogram.count());
+      Assert::AreEqual(50.0, histogram.percentile(0.5), 0.2);
+      Assert::AreEqual(90.0, histogram.percentile(0.9), 0.4);
+
+      // negative samples keep their sign and order, to within the spacing
+      //   of the samples
+      eng::ScatterHistogram signed_samples;
+      for (int i = -50; i < 50; ++i) {
+        signed_samples.add(i + 0.5);
+      }
+      Assert::AreEqual(-40.0, signed_samples.percentile(0.1), 0.6);
+      Assert::AreEqual(0.0, signed_samples.percentile(0.5), 0.6);
+      Assert::AreEqual(40.0, signed_samples.percentile(0.9), 0.6);
+
+      // merging gives the same counts as adding every sample to one
+      histogram.merge(signed_samples);
+      Assert::AreEqual(std::uint64_t(200), histogram.count());
+      Assert::AreEqual(0.0, histogram.percentile(0.25), 0.6);
+    }
+    TEST_METHOD(Reproducible) {
+      const eng::PreloadMonteCarlo mc = simulation().torque(48_Nm, 5_Nm).nut_factor(0.2, 0.03);
+      eng::PreloadMonteCarlo::Batch whole, range;
+      mc.sample(0, 200, whole);
+      mc.sample(100, 10, range);
+      for (std::size_t i = 0; i != 10; ++i) {
+        Assert::AreEqual(whole.preload[100 + i], range.preload[i]);
+        Assert::AreEqual(whole.separation[100 + i], range.separation[i]);
+      }
+
+      // the same seed gives the same run on any number of threads
+      const eng::PreloadReliability one = mc.run(50000, 1);
+      const eng::PreloadReliability four = mc.run(50000, 4);
+      Assert::AreEqual(one.samples(), four.samples());
+      Assert::AreEqual(one.reliability(), four.reliability());
+      Assert::AreEqual(one.preload(0.1), four.preload(0.1));
+      Assert::AreEqual(one.separation(0.5), four.separation(0.5));
+
+      // another seed gives other samples
+      eng::PreloadMonteCarlo::Batch other;
+      eng::PreloadMonteCarlo(mc).seed(7).sample(0, 200, other);
+      Assert::IsFalse(other.preload == whole.preload);
+    }
+    TEST_METHOD(NormalLoad) {
+      // With a fixed preload of 24 kN the joint separates when
+      //   P > Fi/(1 - C) = 32 kN, before it overloads at (Sp At - Fi)/C, so
+      //   the reliability is Phi((32 - 30)/2) = Phi(1)
+      const eng::PreloadReliability results = simulation().run(1000000);
+      Assert::AreEqual(std::uint64_t(1000000), results.samples());
+      Assert::AreEqual(0.84134475, results.reliability(), 2e-3);
+      Assert::AreEqual(24000.0, results.preload(0.5).N(), 100.0);
+      // the median separation factor is Fi/(mean P (1 - C))
+      Assert::AreEqual(1.0666667, results.separation(0.5), 0.01);
+    }
+    TEST_METHOD(Overloaded) {
+      // 150 Nm preloads the bolt to 75 kN, past its proof load, which makes
+      //   the load factor of safety negative
+      const eng::PreloadReliability results = simulation().torque(150_Nm, 0_Nm).run(10000);
+      Assert::AreEqual(0.0, results.reliability());
+      // (60 - 75)/(0.25*30)
+      Assert::AreEqual(-2.0, results.load(0.5), 0.05);
+      Assert::IsTrue(results.load(0.99) < 0);
+    }
+  };
+};  // namespace BoltTests
@@ -0,0 +1,324 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "UnitHelperFunctions.h"
+#include "EngineeringLibrary/Engineering.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace DynamicsTests {
+  namespace {
+    // Unit masses joined by springs of 1000 N/m, so sqrt(k/m) is 31.6 rad/s
+    const double k_over_m = 1000;
+
+    // A chain of n masses. A fixed chain is held to a wall by its first spring.
+    void chain(const std::size_t& n, const bool& fixed, eng::SparseMassMatrix& M,
+               eng::SparseStiffnessMatrix& K) {
+      std::vector<Eigen::Triplet<eng::Mass>> masses;
+      std::vector<Eigen::Triplet<eng::Stiffness>> springs;
+      for (int i = 0; i != static_cast<int>(n); ++i) {
+        masses.emplace_back(i, i, 1_kg);
+        if (i != 0 || fixed) {
+          springs.emplace_back(i, i, eng::Stiffness(k_over_m));
+        }
+        if (i != 0) {
+          springs.emplace_back(i - 1, i - 1, eng::Stiffness(k_over_m));
+          springs.emplace_back(i - 1, i, eng::Stiffness(-k_over_m));
+          springs.emplace_back(i, i - 1, eng::Stiffness(-k_over_m));
+        }
+      }
+      M.resize(n, n);
+      K.resize(n, n);
+      M.setFromTriplets(masses.begin(), masses.end());
+      K.setFromTriplets(springs.begin(), springs.end());
+    }
+
+    // A square membrane of N by N masses joined to their neighbours, held at
+    //   its edges. Modes (p, q) and (q, p) have the same frequency.
+    void grid(const std::size_t& N, eng::SparseMassMatrix& M, eng::SparseStiffnessMatrix& K) {
+      const int n = static_cast<int>(N*N);
+      std::vector<Eigen::Triplet<eng::Mass>> masses;
+      std::vector<Eigen::Triplet<eng::Stiffness>> springs;
+      for (int i = 0; i != n; ++i) {
+        masses.emplace_back(i, i, 1_kg);
+        springs.emplace_back(i, i, eng::Stiffness(4*k_over_m));
+        if (i % N != 0) {
+          springs.emplace_back(i, i - 1, eng::Stiffness(-k_over_m));
+          springs.emplace_back(i - 1, i, eng::Stiffness(-k_over_m));
+        }
+        if (i >= static_cast<int>(N)) {
+          springs.emplace_back(i, i - N, eng::Stiffness(-k_over_m));
+          springs.emplace_back(i - N, i, eng::Stiffness(-k_over_m));
+        }
+      }
+      M.resize(n, n);
+      K.resize(n, n);
+      M.setFromTriplets(masses.begin(), masses.end());
+      K.setFromTriplets(springs.begin(), springs.end());
+    }
+
+    std::vector<double> chain_frequencies(const std::size_t& n, const bool& fixed) {
+      std::vector<double> w;
+      for (std::size_t j = 0; j != n; ++j) {
+        w.push_back(2*std::sqrt(k_over_m)*std::sin(fixed ? (2*j + 1)*eng::pi/(2*(2*n + 1))
+                                                          : j*eng::pi/(2*n)));
+      }
+      return w;
+    }
+
+    std::vector<double> grid_frequencies(const std::size_t& N) {
+      std::vector<double> w;
+      for (std::size_t p = 1; p <= N; ++p) {
+        for (std::size_t q = 1; q <= N; ++q) {
+          w.push_back(std::sqrt(k_over_m*(4 - 2*std::cos(p*eng::pi/(N + 1))
+                                          - 2*std::cos(q*eng::pi/(N + 1)))));
+        }
+      }
+      std::sort(w.begin(), w.end());
+      return w;
+    }
+
+    // Every mode solves K phi = w^2 M phi with phi^T M phi = 1, and the
+    //   modes are M-orthogonal to each other
+    void check_modes(const eng::SparseMassMatrix& M, const eng::SparseStiffnessMatrix& K,
+                     const eng::ModalResults& results, const std::vector<double>& expected) {
+      const Eigen::SparseMatrix<double> m = M.unaryExpr([](const eng::Mass& x) {
+        return x.value(); });
+      const Eigen::SparseMatrix<double> k = K.unaryExpr([](const eng::Stiffness& x) {
+        return x.value(); });
+      const double scale = expected.back();
+      // the solver's tolerance bounds the residual relative to the norm of K,
+      //   which is at most twice its largest diagonal
+      const double bound = 1e-5*2*Eigen::VectorXd(k.diagonal()).maxCoeff();
+      for (std::size_t i = 0; i != results.size(); ++i) {
+        const double w = results.frequencies[i].value();
+        Assert::AreEqual(expected[i], w, 1e-6*scale);
+        const Eigen::VectorXd phi = results.shapes.col(i);
+        const Eigen::VectorXd residual = k*phi - w*w*(m*phi);
+        Assert::IsTrue(residual.norm() <= bound);
+        for (std::size_t j = 0; j <= i; ++j) {
+          Assert::AreEqual(i == j ? 1.0 : 0.0,
+                           results.shapes.col(j).dot(m*phi), 1e-6);
+        }
+      }
+    }
+  };
+
+  TEST_CLASS(TestFrequencyResponse) {
+    // wn = sqrt(800/2) = 20 and zeta = 8/(2*2*20) = 0.1
+    eng::Mass m = 2_kg;
+    eng::Damping c = 8_Nspm;
+    eng::Stiffness k = 800_Npm;
+  public:
+    TEST_METHOD(LinearSweep) {
+      std::vector<eng::Frequency> w;
+      eng::linear_sweep(0.1_Hz, 0.7_Hz, 7, w);
+      Assert::AreEqual(size_t(7), w.size());
+      Assert::IsTrue(w.front() == 0.1_Hz);
+      Assert::IsTrue(w.back() == 0.7_Hz);
+      Assert::AreEqual(0.4, w[3].value(), 1e-15);
+
+      eng::linear_sweep(5_Hz, 9_Hz, 1, w);
+      Assert::AreEqual(size_t(1), w.size());
+      Assert::IsTrue(w.front() == 5_Hz);
+      eng::linear_sweep(5_Hz, 9_Hz, 0, w);
+      Assert::IsTrue(w.empty());
+    }
+    TEST_METHOD(LogSweep) {
+      std::vector<eng::Frequency> w;
+      eng::log_sweep(0.3_Hz, 3000_Hz, 5, w);
+      Assert::AreEqual(size_t(5), w.size());
+      Assert::IsTrue(w.front() == 0.3_Hz);
+      Assert::IsTrue(w.back() == 3000_Hz);
+      Assert::AreEqual(3.0, w[1].value(), 1e-12);
+      Assert::AreEqual(300.0, w[3].value(), 1e-10);
+
+      eng::log_sweep(0.3_Hz, 3000_Hz, 1, w);
+      Assert::IsTrue(w.front() == 0.3_Hz);
+    }
+    TEST_METHOD(Resonance) {
+      const eng::Frequency wn = eng::natural_frequency(m, c, k);
+      const double zeta = eng::damping_ratio(m, c, k);
+      Assert::AreEqual(20.0, wn.value(), 1e-12);
+      Assert::AreEqual(0.1, zeta, 1e-12);
+
+      // At r = 1 the magnitude is 1/(2 zeta) and the response lags by 90
+      //   degrees. The peak is a little higher, at the resonant frequency.
+      const std::vector<eng::Frequency> w{wn, eng::resonant_frequency(wn, zeta)};
+      eng::FrequencyResponse response;
+      eng::frequency_response(m, c, k, w, response);
+      Assert::AreEqual(size_t(2), response.size());
+      Assert::AreEqual(1/(2*zeta), response.magnitude[0], 1e-12);
+      Assert::AreEqual(-eng::pi/2, response.phase[0], 1e-12);
+      Assert::AreEqual(eng::resonant_magnitude_ratio(wn, zeta), response.magnitude[1], 1e-12);
+      Assert::IsTrue(response.magnitude[1] > response.magnitude[0]);
+    }
+    TEST_METHOD(Extremes) {
+      const std::vector<eng::Frequency> w{eng::Frequency(1e-3), eng::Frequency(2e4)};
+      eng::FrequencyResponse response;
+      eng::frequency_response(20_Hz, 0.1, w, response);
+      Assert::AreEqual(1.0, response.magnitude[0], 1e-6);
+      Assert::AreEqual(-1e-5, response.phase[0], 1e-9);
+      Assert::AreEqual(1e-6, response.magnitude[1], 1e-9);
+      Assert::AreEqual(-eng::pi, response.phase[1], 1e-3);
+    }
+    TEST_METHOD(ManySystems) {
+      const std::vector<eng::Frequency> wn{10_Hz, 20_Hz, 40_Hz};
+      const std::vector<double> zeta{0.05, 0.1, 0.2};
+      std::vector<eng::Frequency> w;
+      eng::log_sweep(1_Hz, 100_Hz, 9, w);
+
+      eng::FrequencyResponse response;
+      Assert::IsTrue(eng::frequency_response(wn, zeta, w, response));
+      Assert::AreEqual(size_t(27), response.size());
+      eng::FrequencyResponse single;
+      for (std::size_t i = 0; i != wn.size(); ++i) {
+        eng::frequency_response(wn[i], zeta[i], w, single);
+        for (std::size_t j = 0; j != w.size(); ++j) {
+          Assert::AreEqual(single.magnitude[j], response.magnitude[i*w.size() + j], 1e-15);
+          Assert::AreEqual(single.phase[j], response.phase[i*w.size() + j], 1e-15);
+        }
+      }
+
+      // every system needs a damping ratio
+      Assert::IsFalse(eng::frequency_response(wn, {0.05, 0.1}, w, response));
+      Assert::AreEqual(size_t(0), response.size());
+    }
+  };
+  TEST_CLASS(TestModalAnalysis) {
+  public:
+    TEST_METHOD(DenseChain) {
+      eng::SparseMassMatrix M;
+      eng::SparseStiffnessMatrix K;
+      chain(12, true, M, K);
+      const eng::MassMatrix dense_M = M;
+      const eng::StiffnessMatrix dense_K = K;
+      eng::ModalAnalysis analysis(dense_M, dense_K);
+      Assert::AreEqual(size_t(12), analysis.size());
+
+      eng::ModalResults results;
+      Assert::IsTrue(analysis.solve(12, results));
+      Assert::AreEqual(size_t(12), results.size());
+      check_modes(M, K, results, chain_frequencies(12, true));
+
+      // more modes than degrees of freedom gives every mode
+      Assert::IsTrue(analysis.solve(20, results));
+      Assert::AreEqual(size_t(12), results.size());
+      Assert::IsTrue(analysis.solve(0, results));
+      Assert::AreEqual(size_t(0), results.size());
+    }
+    TEST_METHOD(LanczosChain) {
+      eng::SparseMassMatrix M;
+      eng::SparseStiffnessMatrix K;
+      chain(400, true, M, K);
+      eng::ModalAnalysis analysis(M, K);
+
+      eng::ModalResults results;
+      Assert::IsTrue(analysis.solve(8, results));
+      Assert::AreEqual(size_t(8), results.size());
+      std::vector<double> expected = chain_frequencies(400, true);
+      expected.resize(8);
+      check_modes(M, K, results, expected);
+
+      // the modes about a shift are the ones nearest it
+      Assert::IsTrue(analysis.solve(3, eng::Frequency(expected[5]), results));
+      Assert::AreEqual(size_t(3), results.size());
+      check_modes(M, K, results, {expected[4], expected[5], expected[6]});
+    }
+    TEST_METHOD(FreeFree) {
+      // the rigid body mode makes K singular, which the shift below zero avoids
+      eng::SparseMassMatrix M;
+      eng::SparseStiffnessMatrix K;
+      chain(12, false, M, K);
+      eng::ModalResults results;
+      eng::ModalAnalysis dense{eng::MassMatrix(M), eng::StiffnessMatrix(K)};
+      Assert::IsTrue(dense.solve(4, results));
+      std::vector<double> expected = chain_frequencies(12, false);
+      expected.resize(4);
+      check_modes(M, K, results, expected);
+      Assert::AreEqual(0.0, results.frequencies[0].value(), 1e-4);
+      // every mass moves together in the rigid body mode
+      Assert::AreEqual(results.shapes(0, 0), results.shapes(11, 0), 1e-9);
+
+      chain(300, false, M, K);
+      eng::ModalAnalysis lanczos(M, K);
+      Assert::IsTrue(lanczos.solve(4, results));
+      expected = chain_frequencies(300, false);
+      expected.resize(4);
+      check_modes(M, K, results, expected);
+      Assert::AreEqual(0.0, results.frequencies[0].value(), 1e-3);
+      Assert::AreEqual(results.shapes(0, 0), results.shapes(299, 0), 1e-6);
+    }
+    TEST_METHOD(IllConditioned) {
+      // Stiff springs between pairs of soft ones spread the pivots of K over
+      //   ten orders of magnitude without any shift being near a mode
+      const int n = 300;
+      std::vector<Eigen::Triplet<eng::Mass>> masses;
+      std::vector<Eigen::Triplet<eng::Stiffness>> springs;
+      for (int i = 0; i != n; ++i) {
+        const eng::Stiffness k(i % 2 ? 1e10 : 1.0);
+        masses.emplace_back(i, i, 1_kg);
+        springs.emplace_back(i, i, k);
+        if (i != 0) {
+          springs.emplace_back(i - 1, i - 1, k);
+          springs.emplace_back(i - 1, i, -k);
+          springs.emplace_back(i, i - 1, -k);
+        }
+      }
+      eng::SparseMassMatrix M(n, n);
+      eng::SparseStiffnessMatrix K(n, n);
+      M.setFromTriplets(masses.begin(), masses.end());
+      K.setFromTriplets(springs.begin(), springs.end());
+
+      const Eigen::MatrixXd k = K.unaryExpr([](const eng::Stiffness& x) { return x.value(); });
+      const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> exact(k);
+      std::vector<double> all;
+      for (Eigen::Index i = 0; i != n; ++i) {
+        all.push_back(std::sqrt(std::max(exact.eigenvalues()[i], 0.0)));
+      }
+
+      eng::ModalAnalysis analysis(M, K);
+      eng::ModalResults results;
+      Assert::IsTrue(analysis.solve(3, eng::Frequency(0.3), results));
+      Assert::AreEqual(size_t(3), results.size());
+      // the three modes nearest the shift
+      std::stable_sort(all.begin(), all.end(), [](const double& l, const double& r) {
+        return std::abs(l - 0.3) < std::abs(r - 0.3);
+      });
+      all.resize(3);
+      std::sort(all.begin(), all.end());
+      // the dense solution is only good to rounding in the largest
+      //   eigenvalue, 1e-5 in these frequencies, which is well under the
+      //   spacing of the modes
+      for (std::size_t i = 0; i != 3; ++i) {
+        Assert::AreEqual(all[i], results.frequencies[i].value(), 1e-5);
+      }
+    }
+    TEST_METHOD(RepeatedFrequencies) {
+      eng::SparseMassMatrix M;
+      eng::SparseStiffnessMatrix K;
+      eng::ModalResults results;
+
+      grid(6, M, K);
+      eng::ModalAnalysis dense{eng::MassMatrix(M), eng::StiffnessMatrix(K)};
+      Assert::IsTrue(dense.solve(6, results));
+      std::vector<double> expected = grid_frequencies(6);
+      expected.resize(6);
+      // modes 2 and 3 are (1, 2) and (2, 1), and modes 5 and 6 are (1, 3) and (3, 1)
+      Assert::AreEqual(expected[1], expected[2], 1e-9);
+      Assert::AreEqual(expected[4], expected[5], 1e-9);
+      check_modes(M, K, results, expected);
+
+      grid(18, M, K);
+      eng::ModalAnalysis lanczos(M, K);
+      Assert::IsTrue(lanczos.solve(6, results));
+      expected = grid_frequencies(18);
+      expected.resize(6);
+      check_modes(M, K, results, expected);
+    }
+  };
+};  // namespace DynamicsTests
@@ -0,0 +1,242 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "UnitHelperFunctions.h"
+#include "EngineeringLibrary/Engineering.h"
+
+#include <cmath>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace FailureTests {
+  TEST_CLASS(TestFailureCriteria) {
+    eng::Material material{250_MPa, 400_MPa, 200_GPa, 79_GPa, 0.3};
+    // principal stresses of 110 MPa and -60 MPa
+    eng::StressElement2 planar{100_MPa, -50_MPa, 40_MPa};
+  public:
+    TEST_METHOD(VonMises) {
+      Assert::AreEqual(149.33185_MPa, eng::von_mises(planar));
+      Assert::AreEqual(1.6741238, eng::factor_of_safety_von_mises(planar, material), 1e-6);
+
+      Assert::AreEqual(200_MPa, eng::von_mises(eng::StressElement3(200_MPa)));
+      Assert::AreEqual(173.20508_MPa, eng::von_mises(eng::StressElement3(0_MPa, 0_MPa, 0_MPa,
+                                                                          100_MPa)));
+    }
+    TEST_METHOD(Tresca) {
+      Assert::AreEqual(170_MPa, eng::tresca(planar));
+      Assert::AreEqual(1.4705882, eng::factor_of_safety_tresca(planar, material), 1e-6);
+
+      // the out of plane stress of zero is the smallest principal stress
+      Assert::AreEqual(100_MPa, eng::tresca(eng::StressElement2(100_MPa, 50_MPa)));
+      Assert::AreEqual(200_MPa, eng::tresca(eng::StressElement3(0_MPa, 0_MPa, 0_MPa, 100_MPa)));
+    }
+    TEST_METHOD(CoulombMohr) {
+      // n = 1/(110/400 + 60/1000)
+      Assert::AreEqual(2.9850746, eng::factor_of_safety_mohr_coulomb(planar, material, 1000_MPa),
+                       1e-6);
+      Assert::AreEqual(2.9850746,
+                       eng::factor_of_safety_mohr_coulomb(eng::StressElement3(100_MPa, -50_MPa, 0_MPa,
+                                                                              40_MPa),
+                                                          material, 1000_MPa), 1e-6);
+    }
+    TEST_METHOD(Goodman) {
+      Assert::AreEqual(200_MPa, eng::endurance_limit(material));
+
+      // n = 1/(80/200 + 100/400)
+      const double n = eng::factor_of_safety_goodman(eng::StressElement2(80_MPa),
+                                                     eng::StressElement2(100_MPa), material,
+                                                     eng::endurance_limit(material));
+      Assert::AreEqual(1.5384615, n, 1e-6);
+    }
+    TEST_METHOD(Batch) {
+      eng::StressElement2Array s;
+      s.push_back(planar);
+      s.push_back(eng::StressElement2(50_MPa));
+      std::vector<double> n;
+
+      Assert::AreEqual(1.6741238, eng::factor_of_safety_von_mises(s, material, n), 1e-6);
+      Assert::AreEqual(size_t(2), n.size());
+      Assert::AreEqual(5.0, n[1], 1e-12);
+      Assert::AreEqual(1.4705882, eng::factor_of_safety_tresca(s, material, n), 1e-6);
+      Assert::AreEqual(2.9850746, eng::factor_of_safety_mohr_coulomb(s, material, 1000_MPa, n),
+                       1e-6);
+      Assert::AreEqual(8.0, n[1], 1e-12);
+    }
+    TEST_METHOD(BatchGoodman) {
+      eng::StressElement2Array alternating;
+      eng::StressElement2Array mean;
+      alternating.push_back(eng::StressElement2(80_MPa));
+      alternating.push_back(eng::StressElement2(100_MPa));
+      mean.push_back(eng::StressElement2(100_MPa));
+      mean.push_back(eng::StressElement2(0_MPa));
+      std::vector<double> n;
+
+      Assert::AreEqual(1.5384615, eng::factor_of_safety_goodman(alternating, mean, material,
+                                                                200_MPa, n), 1e-6);
+      Assert::AreEqual(2.0, n[1], 1e-12);
+
+      // every alternating stress needs a mean stress
+      mean.resize(1);
+      Assert::IsTrue(std::isnan(eng::factor_of_safety_goodman(alternating, mean, material,
+                                                              200_MPa, n)));
+      Assert::IsTrue(n.empty());
+    }
+  };
+  TEST_CLASS(TestFatigue) {
+    eng::Material material{250_MPa, 400_MPa, 200_GPa, 79_GPa, 0.3};
+    // the ASTM E1049 example history, whose only closed cycle has a range of 4
+    std::vector<eng::Stress> history{-2_MPa, 1_MPa, -3_MPa, 5_MPa, -1_MPa, 3_MPa,
+                                     -4_MPa, 4_MPa, -2_MPa};
+  public:
+    TEST_METHOD(EstimatedCurve) {
+      // 0.9 St at 10^3 cycles and St/2 at 10^6 cycles
+      eng::SNCurve curve(material);
+      Assert::AreEqual(648_MPa, curve.a());
+      Assert::AreEqual(-0.085090835, curve.b(), 1e-9);
+      Assert::AreEqual(360_MPa, curve.strength(1e3));
+      Assert::AreEqual(243.28808_MPa, curve.strength(1e5));
+      Assert::AreEqual(200_MPa, curve.strength(1e6));
+      Assert::AreEqual(200_MPa, curve.strength(1e8));
+
+      Assert::AreEqual(8522.1592, curve.cycles(300_MPa), 1e-3);
+      Assert::AreEqual(1/8522.1592, curve.damage(300e6), 1e-10);
+      Assert::IsTrue(std::isinf(curve.cycles(150_MPa)));
+      Assert::AreEqual(0.0, curve.damage(150e6));
+    }
+    TEST_METHOD(Rainflow) {
+      eng::SNCurve curve(1000_MPa, -0.1, 1_MPa);
+      eng::RainflowCounter counter(curve, 1_MPa, 10);
+      counter.add(history);
+
+      Assert::AreEqual(1.0, counter.cycles());
+      Assert::AreEqual(1.0, counter.histogram()[4]);
+      const double closed = curve.damage(2e6);
+      Assert::AreEqual(closed, counter.damage(), closed*1e-9);
+
+      // the residue -2, 1, -3, 5, -4, 4 and the last sample are half cycles
+      double total = closed;
+      for (const double& range : {3e6, 4e6, 8e6, 9e6, 8e6, 6e6}) {
+        total += curve.damage(range/2)/2;
+      }
+      Assert::AreEqual(total, counter.total_damage(), total*1e-9);
+
+      counter.reset();
+      Assert::AreEqual(0.0, counter.cycles());
+      Assert::AreEqual(0.0, counter.histogram()[4]);
+    }
+    TEST_METHOD(Chunks) {
+      eng::SNCurve curve(1000_MPa, -0.1, 1_MPa);
+      eng::RainflowCounter whole(curve, 1_MPa, 10);
+      eng::RainflowCounter pieces(curve, 1_MPa, 10);
+      whole.add(history);
+      for (const auto& sample : history) {
+        pieces.add(sample);
+      }
+
+      Assert::AreEqual(whole.cycles(), pieces.cycles());
+      Assert::AreEqual(whole.total_damage(), pieces.total_damage(), whole.total_damage()*1e-12);
+      Assert::IsTrue(whole.histogram() == pieces.histogram());
+    }
+    TEST_METHOD(BinWidth) {
+      eng::SNCurve curve(1000_MPa, -0.1, 1_MPa);
+
+      // ranges past the last bin are counted in it
+      eng::RainflowCounter narrow(curve, 1_MPa, 3);
+      narrow.add(history);
+      Assert::AreEqual(1.0, narrow.histogram()[2]);
+
+      eng::RainflowCounter zero(curve, 0_MPa, 10);
+      zero.add(history);
+      Assert::AreEqual(size_t(1), zero.histogram().size());
+      Assert::AreEqual(1.0, zero.histogram()[0]);
+      Assert::IsTrue(std::isinf(zero.bin_width().value()));
+
+      eng::RainflowCounter negative(curve, -1_MPa, 10);
+      negative.add(history);
+      Assert::AreEqual(1.0, negative.histogram()[0]);
+    }
+  };
+  TEST_CLASS(TestPlasticity) {
+    // hardens from 250 MPa to 400 MPa over an equivalent plastic strain of
+    //   0.1, so H = 1500 MPa
+    eng::Material material{250_MPa, 400_MPa, eng::MaterialBase(200_GPa, 0.3)};
+    eng::PlaneStressPlasticity plasticity{material, 0.1};
+
+    static eng::StrainElement3Array shear(const double& gamma) {
+      eng::StrainElement3Array increment;
+      increment.push_back(eng::NormalStrain(0, 0), eng::ShearStrain(eng::Angle(gamma)));
+      return increment;
+    }
+  public:
+    TEST_METHOD(YieldStress) {
+      Assert::AreEqual(250_MPa, plasticity.yield_stress(0));
+      Assert::AreEqual(325_MPa, plasticity.yield_stress(0.05));
+      Assert::AreEqual(400_MPa, plasticity.yield_stress(0.1));
+      Assert::AreEqual(400_MPa, plasticity.yield_stress(1));
+    }
+    TEST_METHOD(Elastic) {
+      eng::PlasticPointArray state;
+      state.resize(1);
+      Assert::AreEqual(size_t(0), *plasticity.update(shear(1e-3), state));
+      Assert::AreEqual(76.923077e6, state.stress.tau_xy[0], 1.0);
+      Assert::AreEqual(0.0, state.plastic_xy[0]);
+      Assert::AreEqual(0.0, state.equivalent[0]);
+    }
+    TEST_METHOD(PureShear) {
+      // Past tau_y = Sy/sqrt(3) the shear stress rises with the tangent
+      //   G (H/3)/(G + H/3), and the equivalent plastic strain is gamma_p/sqrt(3)
+      eng::PlasticPointArray state;
+      state.resize(1);
+      Assert::AreEqual(size_t(1), *plasticity.update(shear(0.005), state));
+      Assert::AreEqual(145.88929e6, state.stress.tau_xy[0], 10.0);
+      Assert::AreEqual(0.0, state.stress.sigma_x[0], 1e-3);
+      Assert::AreEqual(0.0, state.stress.sigma_y[0], 1e-3);
+      Assert::AreEqual(3.1034393e-3, state.plastic_xy[0], 1e-10);
+      Assert::AreEqual(0.0, state.plastic_x[0], 1e-15);
+      Assert::AreEqual(1.7917715e-3, state.equivalent[0], 1e-10);
+
+      // the response is the same in smaller steps, since the loading is radial
+      eng::PlasticPointArray steps;
+      steps.resize(1);
+      for (int i = 0; i != 10; ++i) {
+        plasticity.update(shear(0.0005), steps);
+      }
+      Assert::AreEqual(state.stress.tau_xy[0], steps.stress.tau_xy[0], 10.0);
+      Assert::AreEqual(state.equivalent[0], steps.equivalent[0], 1e-10);
+
+      // past the ultimate strain the shear stress stays at St/sqrt(3)
+      plasticity.update(shear(0.5), state);
+      Assert::AreEqual(230.94011e6, state.stress.tau_xy[0], 10.0);
+    }
+    TEST_METHOD(Consistency) {
+      // every yielded point returns to the yield surface of its equivalent
+      //   plastic strain
+      eng::StrainElement3Array increment;
+      increment.push_back(eng::NormalStrain(0.004, 0), eng::ShearStrain());
+      increment.push_back(eng::NormalStrain(0.003, -0.002), eng::ShearStrain(eng::Angle(0.002)));
+      increment.push_back(eng::NormalStrain(0.002, 0.002), eng::ShearStrain());
+      increment.push_back(eng::NormalStrain(-0.01, 0.004), eng::ShearStrain(eng::Angle(-0.006)));
+      eng::PlasticPointArray state;
+      state.resize(increment.size());
+
+      for (int step = 0; step != 3; ++step) {
+        Assert::AreEqual(increment.size(), *plasticity.update(increment, state));
+        for (std::size_t i = 0; i != state.size(); ++i) {
+          const eng::Stress vm = eng::von_mises(state.stress[i]);
+          const eng::Stress yield = plasticity.yield_stress(state.equivalent[i]);
+          Assert::AreEqual(yield.value(), vm.value(), yield.value()*1e-9);
+          Assert::IsTrue(state.equivalent[i] > 0);
+        }
+      }
+    }
+    TEST_METHOD(Mismatch) {
+      // every point needs an increment, and a mismatch steps none of them
+      eng::PlasticPointArray state;
+      state.resize(2);
+      Assert::IsFalse(plasticity.update(shear(1e-3), state).has_value());
+      Assert::AreEqual(0.0, state.stress.tau_xy[0]);
+      Assert::AreEqual(0.0, state.stress.tau_xy[1]);
+    }
+  };
+};  // namespace FailureTests
@@ -38,6 +38,28 @@ namespace GeometryTests {
       Assert::AreEqual(7.5_m4, g.Iyy(theta));
       Assert::AreEqual(1.4_m4, g.Ixy(theta));
     }
+    TEST_METHOD(TestPrincipalAxes) {
+      Assert::AreEqual(-0.59514497_rad, g.principal_angle());
+      Assert::AreEqual(7.7696153_m4, g.I1());
+      Assert::AreEqual(0.23038464_m4, g.I2());
+      Assert::AreEqual(g.I1(), g.Ixx(g.principal_angle()));
+    }
+    TEST_METHOD(TestRotatedAxesBatch) {
+      std::vector<eng::Angle> thetas = {0_deg, 45_deg, 90_deg};
+      auto ixx = g.Ixx(thetas);
+      auto iyy = g.Iyy(thetas);
+      auto ixy = g.Ixy(thetas);
+      Assert::AreEqual(5.4_m4, ixx[0]);
+      Assert::AreEqual(0.5_m4, ixx[1]);
+      Assert::AreEqual(2.6_m4, ixx[2]);
+      Assert::AreEqual(7.5_m4, iyy[1]);
+      Assert::AreEqual(1.4_m4, ixy[1]);
+    }
+    TEST_METHOD(TestUnknownBounds) {
+      Assert::IsFalse(g.extents().has_value());
+      Assert::IsFalse(g.Sx().has_value());
+      Assert::IsFalse(g.Zx().has_value());
+    }
     TEST_METHOD(TestCopy) {
       eng::Geometry copied = g;
       Assert::AreEqual(g.area(), copied.area());
@@ -141,6 +163,31 @@ namespace GeometryTests {
     }
   };
 
+  TEST_CLASS(TestSectionModulus) {
+    eng::Rectangle r{2_m, 6_m};
+  public:
+    TEST_METHOD(TestElastic) {
+      Assert::AreEqual(12_m3, *r.Sx());
+      Assert::AreEqual(4_m3, *r.Sy());
+    }
+    TEST_METHOD(TestPlastic) {
+      Assert::AreEqual(18_m3, *r.Zx());
+      Assert::AreEqual(6_m3, *r.Zy());
+    }
+    TEST_METHOD(TestComposite) {
+      eng::Rectangle top(80_mm, 20_mm, {-50_mm, 70_mm, 0_mm});
+      eng::Rectangle cross(20_mm, 160_mm, {0_mm, 0_mm, 0_mm});
+      eng::Rectangle bottom(80_mm, 20_mm, {50_mm, -70_mm, 0_mm});
+
+      eng::Geometry z_beam = top + cross + bottom;
+
+      Assert::AreEqual(80_mm, z_beam.extents()->top);
+      Assert::AreEqual(90_mm, z_beam.extents()->right);
+      Assert::AreEqual(282666.67_mm3, *z_beam.Sx());
+      Assert::IsFalse(z_beam.Zx().has_value());
+    }
+  };
+
   TEST_CLASS(TestHollowRectangle) {
     eng::HollowRectangle hr{5_m, 3_m, 1.0_m, 1.5_m};
   public:
@@ -162,6 +209,39 @@ namespace GeometryTests {
     }
   };
 
+  TEST_CLASS(TestSteelSections) {
+  public:
+    TEST_METHOD(TestFind) {
+      Assert::IsNotNull(eng::steel_sections::find("W8x31"));
+      Assert::IsNotNull(eng::steel_sections::find("w8X31"));
+      Assert::IsNotNull(eng::steel_sections::find("IPE 200"));
+      Assert::IsNull(eng::steel_sections::find("W8x32"));
+      Assert::IsNull(eng::steel_sections::find(""));
+    }
+    TEST_METHOD(TestWideFlange) {
+      const eng::SteelSection* w = eng::steel_sections::find("W8x31");
+      Assert::AreEqual(8.99205_in2, w->area());
+      Assert::AreEqual(108.2972_in4, w->Ixx());
+      Assert::AreEqual(0_in4, w->Ixy());
+    }
+    TEST_METHOD(TestGeometry) {
+      eng::Geometry g = eng::steel_sections::find("IPE200")->geometry();
+      Assert::AreEqual(27.248_cm2, g.area());
+      Assert::AreEqual(100_mm, g.extents()->top);
+      Assert::AreEqual(184.559_cm3, *g.Sx());
+      // the published plastic modulus is rounded to 0.01 cm^3
+      Assert::AreEqual(209.66e-6, g.Zx()->value(), 0.01e-6);
+    }
+    TEST_METHOD(TestIterate) {
+      size_t count = 0;
+      for (auto s = eng::steel_sections::begin(); s != eng::steel_sections::end(); ++s) {
+        Assert::IsTrue(s == eng::steel_sections::find(s->designation()));
+        ++count;
+      }
+      Assert::AreEqual(eng::steel_sections::size(), count);
+    }
+  };
+
   TEST_CLASS(TestCompositeShapes) {
   public:
     TEST_METHOD(ZBeam) {
@@ -185,4 +265,263 @@ namespace GeometryTests {
       Assert::AreEqual(886.35986_in4, bearing_block.Ixx(0_in));
     }
   };
+  TEST_CLASS(TestCompositeSection) {
+  public:
+    TEST_METHOD(ZBeam) {
+      eng::CompositeSection section;
+      section.add(eng::Rectangle(80_mm, 20_mm, {-50_mm, 70_mm, 0_mm}))
+             .add(eng::Rectangle(20_mm, 160_mm, {0_mm, 0_mm, 0_mm}))
+             .add(eng::Rectangle(80_mm, 20_mm, {50_mm, -70_mm, 0_mm}));
+
+      eng::Geometry z_beam = section.geometry();
+
+      Assert::AreEqual(size_t(3), section.size());
+      Assert::AreEqual(6400_mm2, z_beam.area());
+      Assert::AreEqual(22.61333e6_mm4, z_beam.Ixx());
+      Assert::AreEqual(9.813333e6_mm4, z_beam.Iyy());
+      Assert::AreEqual(-11.2e6_mm4, z_beam.Ixy());
+    }
+    TEST_METHOD(BearingBlock) {
+      eng::CompositeSection section;
+      section += eng::Rectangle(12_in, 4_in, {0_in, 2_in, 0_in});
+      section += eng::SemiCircle(8_in, {0_in, 5.6976527_in, 0_in});
+      section -= eng::Circle(4_in, {0_in, 4_in, 0_in});
+
+      eng::Geometry bearing_block = section.geometry();
+
+      Assert::AreEqual(886.35986_in4, bearing_block.Ixx(0_in));
+    }
+    TEST_METHOD(MatchesOperators) {
+      eng::Rectangle web(10_mm, 300_mm, {0_mm, 0_mm, 0_mm});
+      eng::Rectangle flange(150_mm, 15_mm, {0_mm, 157.5_mm, 0_mm});
+      eng::Rectangle plate(200_mm, 10_mm, {20_mm, -155_mm, 0_mm});
+
+      eng::Geometry chained = web + flange + plate;
+      eng::Geometry built = eng::CompositeSection().add(web).add(flange).add(plate).geometry();
+
+      Assert::AreEqual(chained.area(), built.area());
+      Assert::AreEqual(chained.centroid(), built.centroid());
+      Assert::AreEqual(chained.Ixx(), built.Ixx());
+      Assert::AreEqual(chained.Iyy(), built.Iyy());
+      Assert::AreEqual(chained.Ixy(), built.Ixy());
+    }
+  };
+  TEST_CLASS(TestTorsionProperties) {
+  public:
+    TEST_METHOD(ClosedForms) {
+      eng::Circle circle(2_m, {1_m, 2_m, 0_m});
+      eng::Rectangle square(2_m, 2_m);
+      eng::HollowRectangle tube(4_in, 4_in, 3.5_in, 3.5_in);
+
+      Assert::AreEqual(1.5707963_m4, *circle.J());
+      Assert::AreEqual(circle.centroid(), *circle.shear_center());
+      Assert::AreEqual(2.2533333_m4, *square.J());
+      Assert::AreEqual(13.183594_in4, *tube.J());
+    }
+    TEST_METHOD(Channel) {
+      eng::ThinWalledSection channel;
+      auto a = channel.add_node(80_mm, 0_mm);
+      auto b = channel.add_node(0_mm, 0_mm);
+      auto c = channel.add_node(0_mm, 200_mm);
+      auto d = channel.add_node(80_mm, 200_mm);
+      channel.add_segment(a, b, 10_mm);
+      channel.add_segment(b, c, 6_mm);
+      channel.add_segment(c, d, 10_mm);
+
+      eng::Geometry g = channel.geometry();
+
+      Assert::IsTrue(channel.is_open());
+      Assert::AreEqual(eng::LengthVec(-32_mm, 100_mm, 0_mm), *g.shear_center());
+      Assert::AreEqual(67733.333_mm4, *g.J());
+      Assert::AreEqual(1.3653333e-8, g.Cw()->value(), 1e-14);
+
+      channel.move_node(a, 100_mm, 0_mm);
+      channel.move_node(d, 100_mm, 200_mm);
+      Assert::AreEqual(-41.666667_mm, channel.geometry().shear_center()->x());
+    }
+    TEST_METHOD(IBeam) {
+      eng::ThinWalledSection beam;
+      auto bl = beam.add_node(-50_mm, 0_mm);
+      auto bc = beam.add_node(0_mm, 0_mm);
+      auto br = beam.add_node(50_mm, 0_mm);
+      auto tl = beam.add_node(-50_mm, 200_mm);
+      auto tc = beam.add_node(0_mm, 200_mm);
+      auto tr = beam.add_node(50_mm, 200_mm);
+      beam.add_segment(bl, bc, 10_mm);
+      beam.add_segment(bc, br, 10_mm);
+      beam.add_segment(bc, tc, 6_mm);
+      beam.add_segment(tl, tc, 10_mm);
+      beam.add_segment(tc, tr, 10_mm);
+
+      eng::Geometry g = beam.geometry();
+
+      Assert::AreEqual(100_mm, g.shear_center()->y());
+      Assert::AreEqual(1.6666667e-8, g.Cw()->value(), 1e-14);
+    }
+    TEST_METHOD(SemiCircle) {
+      eng::SemiCircle half(2_m, {0_m, 1_m, 0_m});
+
+      Assert::AreEqual(0.29755678_m4, *half.J());
+      Assert::AreEqual(eng::LengthVec(0_m, 1.0848826_m, 0_m), *half.shear_center());
+      Assert::AreEqual(0.0059200, half.Cw()->value(), 1e-7);
+    }
+    TEST_METHOD(Box) {
+      eng::ThinWalledSection box;
+      auto a = box.add_node(0_mm, 0_mm);
+      auto b = box.add_node(100_mm, 0_mm);
+      auto c = box.add_node(100_mm, 200_mm);
+      auto d = box.add_node(0_mm, 200_mm);
+      box.add_segment(a, b, 5_mm);
+      box.add_segment(b, c, 5_mm);
+      box.add_segment(c, d, 5_mm);
+      auto web = box.add_segment(d, a, 5_mm);
+
+      Assert::IsFalse(box.is_open());
+      Assert::AreEqual(size_t(1), box.cells());
+
+      // Bredt: J = 4A^2/(sum of L/t)
+      eng::Geometry g = box.geometry();
+      Assert::AreEqual(1.3333333e7_mm4, *g.J());
+      Assert::AreEqual(eng::LengthVec(50_mm, 100_mm, 0_mm), *g.shear_center());
+
+      // a thicker web draws the shear center towards it
+      Assert::IsTrue(box.set_thickness(*web, 10_mm));
+      g = box.geometry();
+      Assert::AreEqual(1.6e7_mm4, *g.J());
+      Assert::AreEqual(31.666667_mm, g.shear_center()->x());
+    }
+    TEST_METHOD(TwoCells) {
+      eng::ThinWalledSection section;
+      auto a = section.add_node(0_mm, 0_mm);
+      auto b = section.add_node(100_mm, 0_mm);
+      auto c = section.add_node(200_mm, 0_mm);
+      auto d = section.add_node(200_mm, 100_mm);
+      auto e = section.add_node(100_mm, 100_mm);
+      auto f = section.add_node(0_mm, 100_mm);
+      section.add_segment(a, b, 5_mm);
+      section.add_segment(b, c, 5_mm);
+      section.add_segment(c, d, 5_mm);
+      section.add_segment(d, e, 5_mm);
+      section.add_segment(e, f, 5_mm);
+      section.add_segment(f, a, 5_mm);
+      section.add_segment(b, e, 5_mm);
+
+      eng::Geometry g = section.geometry();
+
+      // the middle web carries no shear flow, so the torsion constant is the
+      //   same as that of the outer cell alone
+      Assert::AreEqual(size_t(2), section.cells());
+      Assert::AreEqual(1.3333333e7_mm4, *g.J());
+      Assert::AreEqual(eng::LengthVec(100_mm, 50_mm, 0_mm), *g.shear_center());
+    }
+    TEST_METHOD(Unknown) {
+      eng::ThinWalledSection pieces;
+      pieces.add_segment(pieces.add_node(0_mm, 0_mm), pieces.add_node(100_mm, 0_mm), 5_mm);
+      pieces.add_segment(pieces.add_node(0_mm, 50_mm), pieces.add_node(100_mm, 50_mm), 5_mm);
+
+      Assert::IsFalse(pieces.is_connected());
+      Assert::IsFalse(pieces.geometry().J().has_value());
+
+      eng::Geometry composite = eng::Rectangle(1_m, 2_m) + eng::Circle(1_m, {2_m, 0_m, 0_m});
+      Assert::IsFalse(composite.J().has_value());
+    }
+    TEST_METHOD(BadIndices) {
+      eng::ThinWalledSection section;
+      auto a = section.add_node(0_mm, 0_mm);
+      auto b = section.add_node(100_mm, 0_mm);
+      auto flange = section.add_segment(a, b, 5_mm);
+      Assert::IsTrue(flange.has_value());
+
+      // segments need two different nodes which exist and a positive thickness
+      Assert::IsFalse(section.add_segment(a, 2, 5_mm).has_value());
+      Assert::IsFalse(section.add_segment(7, b, 5_mm).has_value());
+      Assert::IsFalse(section.add_segment(a, a, 5_mm).has_value());
+      Assert::IsFalse(section.add_segment(a, b, 0_mm).has_value());
+      Assert::AreEqual(size_t(1), section.segments());
+
+      Assert::IsFalse(section.move_node(2, 0_mm, 50_mm));
+      Assert::IsFalse(section.set_thickness(1, 5_mm));
+      Assert::IsFalse(section.set_thickness(*flange, -5_mm));
+      Assert::IsTrue(section.move_node(b, 50_mm, 0_mm));
+      Assert::IsTrue(section.is_open());
+      Assert::AreEqual(250_mm2, section.geometry().area());
+    }
+  };
+  TEST_CLASS(TestSectionOptimizer) {
+  public:
+    TEST_METHOD(LightestRectangle) {
+      auto design = eng::SectionOptimizer(eng::SectionOptimizer::Shape::RECTANGLE)
+        .base(10_mm, 50_mm)
+        .height(10_mm, 200_mm)
+        .require_Sx(50000_mm3)
+        .optimize();
+
+      Assert::IsTrue(design.has_value());
+      Assert::AreEqual(10_mm, design->base);
+      Assert::AreEqual(173.20508_mm, design->height);
+      Assert::AreEqual(1732.0508_mm2, design->geometry().area());
+    }
+    TEST_METHOD(LightestTube) {
+      auto design = eng::SectionOptimizer(eng::SectionOptimizer::Shape::HOLLOW_CIRCLE)
+        .base(20_mm, 100_mm)
+        .thickness(2_mm, 10_mm)
+        .require_Ixx(1e6_mm4)
+        .require_radius_of_gyration(30_mm)
+        .optimize();
+
+      eng::Geometry g = design->geometry();
+      Assert::IsTrue(g.Ixx() >= 1e6_mm4);
+      Assert::IsTrue(eng::radius_of_gyration(g.Ixx(), g.area()) >= 30_mm);
+      Assert::AreEqual(845.52_mm2, g.area());
+    }
+    TEST_METHOD(Batch) {
+      eng::SectionOptimizer box(eng::SectionOptimizer::Shape::HOLLOW_RECTANGLE);
+      eng::SectionOptimizer::Batch batch;
+      batch.base = {0.1, 0.05};
+      batch.height = {0.2, 0.05};
+      batch.thickness = {0.01, 0.03};
+      box.evaluate(batch);
+
+      eng::HollowRectangle tube(100_mm, 200_mm, 80_mm, 180_mm);
+      Assert::AreEqual(tube.area().value(), batch.area[0], 1e-12);
+      Assert::AreEqual(tube.Ixx().value(), batch.Ixx[0], 1e-12);
+      Assert::AreEqual(0.0, batch.area[1]);
+    }
+    TEST_METHOD(BatchMatchesShapes) {
+      eng::SectionOptimizer::Batch batch;
+      batch.base = {0.1};
+      batch.height = {0.2};
+      batch.thickness = {0.01};
+
+      eng::SectionOptimizer(eng::SectionOptimizer::Shape::RECTANGLE).evaluate(batch);
+      eng::Rectangle rectangle(100_mm, 200_mm);
+      Assert::AreEqual(rectangle.area().value(), batch.area[0], 1e-12);
+      Assert::AreEqual(rectangle.Ixx().value(), batch.Ixx[0], 1e-12);
+      Assert::AreEqual(rectangle.Iyy().value(), batch.Iyy[0], 1e-12);
+      Assert::AreEqual(rectangle.Sx()->value(), batch.Sx[0], 1e-12);
+
+      eng::SectionOptimizer(eng::SectionOptimizer::Shape::HOLLOW_RECTANGLE).evaluate(batch);
+      eng::HollowRectangle box(100_mm, 200_mm, 80_mm, 180_mm);
+      Assert::AreEqual(box.area().value(), batch.area[0], 1e-12);
+      Assert::AreEqual(box.Ixx().value(), batch.Ixx[0], 1e-12);
+      Assert::AreEqual(box.Iyy().value(), batch.Iyy[0], 1e-12);
+      Assert::AreEqual(box.Sx()->value(), batch.Sx[0], 1e-12);
+
+      eng::SectionOptimizer(eng::SectionOptimizer::Shape::HOLLOW_CIRCLE).evaluate(batch);
+      eng::HollowCircle tube(100_mm, 80_mm);
+      Assert::AreEqual(tube.area().value(), batch.area[0], 1e-12);
+      Assert::AreEqual(tube.Ixx().value(), batch.Ixx[0], 1e-12);
+      Assert::AreEqual(tube.Iyy().value(), batch.Iyy[0], 1e-12);
+      Assert::AreEqual(tube.Sx()->value(), batch.Sx[0], 1e-12);
+    }
+    TEST_METHOD(Infeasible) {
+      auto design = eng::SectionOptimizer(eng::SectionOptimizer::Shape::RECTANGLE)
+        .base(10_mm, 20_mm)
+        .height(10_mm, 20_mm)
+        .require_Ixx(1_m4)
+        .optimize();
+
+      Assert::IsFalse(design.has_value());
+    }
+  };
 };  // namespace GeometryTests
@@ -0,0 +1,453 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "UnitHelperFunctions.h"
+#include "EngineeringLibrary/Engineering.h"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace MaterialTests {
+  TEST_CLASS(TestThermal) {
+    // 10 at 300 K, 20 at 400 K and 0 at 600 K
+    eng::PropertyCurve curve{{300_Kelvin, 400_Kelvin, 600_Kelvin}, {10, 20, 0}};
+    eng::MaterialBase steel{200_GPa, 80_GPa, 0.3};
+  public:
+    TEST_METHOD(Lookup) {
+      Assert::AreEqual(10.0, curve.at(300), 1e-12);
+      Assert::AreEqual(15.0, curve.at(350), 1e-12);
+      Assert::AreEqual(20.0, curve.at(400), 1e-12);
+      Assert::AreEqual(10.0, curve(500_Kelvin), 1e-12);
+      Assert::AreEqual(0.0, curve.at(600), 1e-12);
+
+      // every lookup matches interpolating the segment it falls in
+      for (double T = 300; T <= 600; T += 0.37) {
+        const double expected = T <= 400 ? 10 + (T - 300)/10 : 20 - (T - 400)/10;
+        Assert::AreEqual(expected, curve.at(T), 1e-9);
+      }
+
+      std::vector<double> values;
+      curve.evaluate({350_Kelvin, 500_Kelvin}, values);
+      Assert::AreEqual(size_t(2), values.size());
+      Assert::AreEqual(15.0, values[0], 1e-12);
+      Assert::AreEqual(10.0, values[1], 1e-12);
+    }
+    TEST_METHOD(Clamping) {
+      Assert::AreEqual(10.0, curve.at(0), 1e-12);
+      Assert::AreEqual(10.0, curve.at(299.9), 1e-12);
+      Assert::AreEqual(0.0, curve.at(600.1), 1e-12);
+      Assert::AreEqual(0.0, curve.at(1e6), 1e-12);
+
+      eng::PropertyCurve constant(7);
+      Assert::AreEqual(7.0, constant.at(0), 1e-12);
+      Assert::AreEqual(7.0, constant.at(1000), 1e-12);
+
+      // a single point is a constant
+      eng::PropertyCurve single({400_Kelvin}, {3});
+      Assert::AreEqual(3.0, single.at(300), 1e-12);
+      Assert::AreEqual(3.0, single.at(500), 1e-12);
+    }
+    TEST_METHOD(Unordered) {
+      // temperatures out of order leave the property constant at the first value
+      eng::PropertyCurve reversed({400_Kelvin, 300_Kelvin}, {1, 2});
+      Assert::AreEqual(1.0, reversed.at(350), 1e-12);
+      Assert::AreEqual(1.0, reversed.at(250), 1e-12);
+      Assert::AreEqual(1.0, reversed.at(450), 1e-12);
+
+      eng::PropertyCurve folded({300_Kelvin, 500_Kelvin, 400_Kelvin}, {1, 2, 3});
+      Assert::AreEqual(1.0, folded.at(450), 1e-12);
+      Assert::AreEqual(1.0, folded.at(600), 1e-12);
+
+      // a repeated temperature is a step, which is still in order
+      eng::PropertyCurve step({300_Kelvin, 400_Kelvin, 400_Kelvin, 500_Kelvin}, {1, 1, 5, 5});
+      Assert::AreEqual(1.0, step.at(350), 1e-12);
+      Assert::AreEqual(5.0, step.at(450), 1e-12);
+    }
+    TEST_METHOD(ThermalStrain) {
+      eng::ThermalMaterial material(steel, eng::ThermalExpansion(12e-6));
+      Assert::AreEqual(0.0, material.thermal_strain(eng::Celcius(20)), 1e-15);
+      Assert::AreEqual(1.2e-3, material.thermal_strain(eng::Celcius(120)), 1e-12);
+
+      std::vector<double> strain;
+      material.thermal_strain({eng::Celcius(120), eng::Celcius(-30)}, strain);
+      Assert::AreEqual(1.2e-3, strain[0], 1e-12);
+      Assert::AreEqual(-0.6e-3, strain[1], 1e-12);
+    }
+    TEST_METHOD(ThermalStress) {
+      // -E alpha dT/(1 - k nu) for a 100 K rise
+      eng::ThermalMaterial material(steel, eng::ThermalExpansion(12e-6));
+      using Restraint = eng::ThermalMaterial::Restraint;
+      Assert::AreEqual(-240_MPa, material.thermal_stress(eng::Celcius(120), Restraint::UNIAXIAL));
+      Assert::AreEqual(-342.85714_MPa, material.thermal_stress(eng::Celcius(120),
+                                                                Restraint::BIAXIAL));
+      Assert::AreEqual(-600_MPa, material.thermal_stress(eng::Celcius(120), Restraint::TRIAXIAL));
+
+      std::vector<double> stress;
+      material.thermal_stress({eng::Celcius(120), eng::Celcius(20)}, Restraint::BIAXIAL, stress);
+      Assert::AreEqual(-342.85714e6, stress[0], 10.0);
+      Assert::AreEqual(0.0, stress[1], 1e-6);
+    }
+    TEST_METHOD(Properties) {
+      // the modulus of rigidity given with the material is kept
+      eng::ThermalMaterial constant(steel, eng::ThermalExpansion(12e-6));
+      const eng::MaterialBase hot = constant.at(eng::Celcius(500));
+      Assert::AreEqual(200_GPa, hot.E());
+      Assert::AreEqual(80_GPa, hot.G());
+      Assert::AreEqual(0.3, hot.nu(), 1e-12);
+
+      // E falls from 200 GPa at 300 K to 150 GPa at 800 K
+      eng::ThermalMaterial curves(eng::PropertyCurve({300_Kelvin, 800_Kelvin}, {200e9, 150e9}),
+                                  eng::PropertyCurve(0.25), eng::PropertyCurve(12e-6));
+      const eng::MaterialBase warm = curves.at(550_Kelvin);
+      Assert::AreEqual(175_GPa, warm.E());
+      Assert::AreEqual(70_GPa, warm.G());
+      Assert::AreEqual(12e-6, curves.alpha(550_Kelvin).value(), 1e-18);
+    }
+  };
+  TEST_CLASS(TestBasicMaterials) {
+  public:
+    TEST_METHOD(Constants) {
+      Assert::AreEqual(207_GPa, eng::basic_materials::steel.E());
+      Assert::AreEqual(79.3_GPa, eng::basic_materials::steel.G());
+      Assert::AreEqual(0.292, eng::basic_materials::steel.nu(), 1e-12);
+      Assert::AreEqual(71.7_GPa, eng::basic_materials::aluminum.E());
+      Assert::AreEqual(0.340, eng::basic_materials::titanium.nu(), 1e-12);
+    }
+    TEST_METHOD(Find) {
+      const eng::MaterialGrade* grade = eng::basic_materials::find("1018 CD");
+      Assert::IsNotNull(grade);
+      Assert::IsTrue(grade->designation() == "1018 CD");
+      Assert::AreEqual(370_MPa, grade->Sy());
+      Assert::AreEqual(440_MPa, grade->St());
+      Assert::AreEqual(207_GPa, grade->E());
+
+      const eng::Material material = grade->material();
+      Assert::AreEqual(370_MPa, material.Sy());
+      Assert::AreEqual(79.3_GPa, material.G());
+
+      Assert::AreEqual(276_MPa, eng::basic_materials::find("6061-T6")->Sy());
+      Assert::AreEqual(190_GPa, eng::basic_materials::find("304 A")->E());
+    }
+    TEST_METHOD(FindIgnoresCaseAndSpaces) {
+      const eng::MaterialGrade* grade = eng::basic_materials::find("1018 CD");
+      Assert::IsTrue(eng::basic_materials::find("1018cd") == grade);
+      Assert::IsTrue(eng::basic_materials::find(" 1018  Cd ") == grade);
+      Assert::IsTrue(eng::basic_materials::find("6061-t6") == eng::basic_materials::find("6061-T6"));
+    }
+    TEST_METHOD(FindMissing) {
+      Assert::IsNull(eng::basic_materials::find(""));
+      Assert::IsNull(eng::basic_materials::find("1018"));
+      Assert::IsNull(eng::basic_materials::find("1018 CDX"));
+      Assert::IsNull(eng::basic_materials::find("9999 HR"));
+    }
+    TEST_METHOD(EveryGrade) {
+      // every material in the table is found at its own entry
+      Assert::AreEqual(size_t(34), eng::basic_materials::size());
+      for (auto it = eng::basic_materials::begin(); it != eng::basic_materials::end(); ++it) {
+        Assert::IsTrue(eng::basic_materials::find(it->designation()) == it);
+        Assert::IsTrue(it->Sy() <= it->St());
+      }
+    }
+  };
+  TEST_CLASS(TestMaterialLibrary) {
+    static std::string temp_path(const std::string& name) {
+      return (std::filesystem::temp_directory_path() / ("MaterialTests_" + name)).string();
+    }
+
+    static std::string write(const std::string& name, const std::string& text) {
+      const std::string path = temp_path(name);
+      std::ofstream(path, std::ios::binary | std::ios::trunc) << text;
+      return path;
+    }
+
+    const std::string csv =
+      "# proprietary alloys\n"
+      "nu, E, designation, Sy, St, G\n"
+      "0.3, 200, Alloy B, 350, 500, 80\n"
+      "0.33, 70, alloy a, 250.5, 300, 26\n"
+      "\n"
+      "0.29, 210, Alloy C, 600, 750, 81\n";
+  public:
+    TEST_METHOD(ReadCsv) {
+      auto library = eng::MaterialLibrary::read_csv(write("read.csv", csv));
+      Assert::IsTrue(library.has_value());
+      Assert::IsFalse(library->mapped());
+      Assert::AreEqual(size_t(3), library->size());
+
+      // the records are sorted by designation, ignoring letter case
+      Assert::IsTrue(library->begin()[0].designation() == "alloy a");
+      Assert::IsTrue(library->begin()[2].designation() == "Alloy C");
+
+      const eng::MaterialGrade* b = library->find("ALLOY B");
+      Assert::IsNotNull(b);
+      Assert::AreEqual(350_MPa, b->Sy());
+      Assert::AreEqual(500_MPa, b->St());
+      Assert::AreEqual(200_GPa, b->E());
+      Assert::AreEqual(80_GPa, b->G());
+      Assert::AreEqual(0.3, b->nu(), 1e-12);
+      Assert::AreEqual(250.5_MPa, library->find("Alloy A")->Sy());
+      Assert::IsNull(library->find("Alloy D"));
+    }
+    TEST_METHOD(DerivedRigidity) {
+      // without a G column, G is E/(2(1 + nu))
+      auto library = eng::MaterialLibrary::read_csv(write("derived.csv",
+        "designation,Sy,St,E,nu\nX1,100,200,260,0.3\n"));
+      Assert::IsTrue(library.has_value());
+      Assert::AreEqual(100_GPa, library->find("X1")->G());
+    }
+    TEST_METHOD(Duplicates) {
+      // the last line of a repeated designation is kept, however it is written
+      auto library = eng::MaterialLibrary::read_csv(write("duplicates.csv",
+        "designation,Sy,St,E,nu\n"
+        "X1,100,200,200,0.3\n"
+        "X2,150,250,200,0.3\n"
+        "x 1,120,220,200,0.3\n"
+        "X1,130,230,200,0.3\n"));
+      Assert::IsTrue(library.has_value());
+      Assert::AreEqual(size_t(2), library->size());
+      Assert::AreEqual(130_MPa, library->find("X1")->Sy());
+      Assert::AreEqual(150_MPa, library->find("X2")->Sy());
+    }
+    TEST_METHOD(BadCsv) {
+      Assert::IsFalse(eng::MaterialLibrary::read_csv(temp_path("missing.csv")).has_value());
+      // no header
+      Assert::IsFalse(eng::MaterialLibrary::read_csv(write("empty.csv", "# nothing\n"))
+                      .has_value());
+      // no St column
+      Assert::IsFalse(eng::MaterialLibrary::read_csv(write("columns.csv",
+        "designation,Sy,E,nu\nX1,100,200,0.3\n")).has_value());
+      // a bad number
+      Assert::IsFalse(eng::MaterialLibrary::read_csv(write("number.csv",
+        "designation,Sy,St,E,nu\nX1,100,2oo,200,0.3\n")).has_value());
+      // a line which ends before the designation column
+      Assert::IsFalse(eng::MaterialLibrary::read_csv(write("short.csv",
+        "Sy,St,E,nu,designation\n100,200,200,0.3\n")).has_value());
+      // a designation longer than a record holds
+      Assert::IsFalse(eng::MaterialLibrary::read_csv(write("long.csv",
+        "designation,Sy,St,E,nu\nAn alloy with a long name,100,200,200,0.3\n")).has_value());
+    }
+    TEST_METHOD(CacheRoundTrip) {
+      auto library = eng::MaterialLibrary::read_csv(write("round.csv", csv));
+      const std::string cache = temp_path("round.cache");
+      Assert::IsTrue(library->write_cache(cache));
+
+      auto mapped = eng::MaterialLibrary::map_cache(cache);
+      Assert::IsTrue(mapped.has_value());
+      Assert::IsTrue(mapped->mapped());
+      Assert::AreEqual(library->size(), mapped->size());
+      for (std::size_t i = 0; i != library->size(); ++i) {
+        const eng::MaterialGrade& l = library->begin()[i];
+        const eng::MaterialGrade& r = mapped->begin()[i];
+        Assert::IsTrue(l.designation() == r.designation());
+        Assert::AreEqual(l.Sy(), r.Sy());
+        Assert::AreEqual(l.G(), r.G());
+        Assert::AreEqual(l.nu(), r.nu());
+      }
+      Assert::AreEqual(600_MPa, mapped->find("alloy c")->Sy());
+
+      // a moved library keeps its mapping
+      eng::MaterialLibrary moved = std::move(*mapped);
+      Assert::IsTrue(moved.mapped());
+      Assert::AreEqual(350_MPa, moved.find("Alloy B")->Sy());
+    }
+    TEST_METHOD(Open) {
+      const std::string source = write("open.csv", csv);
+      const std::string cache = temp_path("open.cache");
+      std::filesystem::remove(cache);
+
+      // the first open builds the cache, and the second maps it
+      auto first = eng::MaterialLibrary::open(source, cache);
+      Assert::IsTrue(first.has_value() && first->mapped());
+      Assert::IsTrue(std::filesystem::exists(cache));
+      auto second = eng::MaterialLibrary::open(source, cache);
+      Assert::IsTrue(second.has_value() && second->mapped());
+      Assert::AreEqual(size_t(3), second->size());
+    }
+    TEST_METHOD(BadCache) {
+      auto library = eng::MaterialLibrary::read_csv(write("bad.csv", csv));
+      const std::string cache = temp_path("bad.cache");
+      Assert::IsTrue(library->write_cache(cache));
+      std::string bytes;
+      {
+        std::ifstream file(cache, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+      }
+      Assert::AreEqual(size_t(64 + 3*64), bytes.size());
+
+      // truncated
+      write("truncated.cache", bytes.substr(0, bytes.size() - 1));
+      Assert::IsFalse(eng::MaterialLibrary::map_cache(temp_path("truncated.cache")).has_value());
+
+      // another version of the format
+      std::string version = bytes;
+      version[8] = 2;
+      write("version.cache", version);
+      Assert::IsFalse(eng::MaterialLibrary::map_cache(temp_path("version.cache")).has_value());
+
+      // the last designation filling its field without a terminator, which
+      //   would still sort after the others
+      std::string unterminated = bytes;
+      std::fill(unterminated.begin() + 192, unterminated.begin() + 192 + 24, 'Z');
+      write("unterminated.cache", unterminated);
+      Assert::IsFalse(eng::MaterialLibrary::map_cache(temp_path("unterminated.cache"))
+                      .has_value());
+
+      // records out of order
+      std::string unsorted = bytes;
+      std::swap_ranges(unsorted.begin() + 64, unsorted.begin() + 128, unsorted.begin() + 128);
+      write("unsorted.cache", unsorted);
+      Assert::IsFalse(eng::MaterialLibrary::map_cache(temp_path("unsorted.cache")).has_value());
+    }
+  };
+  TEST_CLASS(TestMaterialBase) {
+  public:
+    TEST_METHOD(ElasticConstants) {
+      const eng::MaterialBase steel(200_GPa, 76.923077_GPa, 0.3);
+      Assert::AreEqual(1/200e9, steel.inverse_E(), 1e-24);
+      Assert::AreEqual(1/76.923077e9, steel.inverse_G(), 1e-24);
+      Assert::AreEqual(115.38462e9, steel.lambda().Pa(), 1e4);
+      Assert::AreEqual(166.66667e9, steel.K().Pa(), 1e4);
+      Assert::AreEqual(219.78022e9, steel.plane_stress_modulus().Pa(), 1e4);
+
+      // lambda and K are the same whichever pair of constants gives them
+      const eng::MaterialBase rubber(2_MPa, 0.49);
+      Assert::AreEqual(2e6*0.49/(1.49*0.02), rubber.lambda().Pa(), 1e-3);
+      Assert::AreEqual(2e6/0.06, rubber.K().Pa(), 1e-3);
+      Assert::AreEqual(rubber.K().Pa(), rubber.lambda().Pa() + 2*rubber.G().Pa()/3, 1e-3);
+    }
+    TEST_METHOD(PoissonConstructor) {
+      const eng::MaterialBase steel(200_GPa, 0.3);
+      Assert::AreEqual(200_GPa, steel.E());
+      Assert::AreEqual(76.923077_GPa, steel.G());
+      Assert::AreEqual(0.3, steel.nu(), 1e-15);
+      Assert::IsTrue(steel.consistent(1e-12));
+
+      const eng::MaterialBase auxetic(1_GPa, -0.5);
+      Assert::AreEqual(1_GPa, auxetic.G());
+    }
+    TEST_METHOD(Consistent) {
+      Assert::IsTrue(eng::basic_materials::steel.consistent());
+      Assert::IsTrue(eng::basic_materials::aluminum.consistent());
+      Assert::IsTrue(eng::MaterialBase(200_GPa, 79_GPa, 0.3).consistent());
+
+      // G is 2.7% above E/(2(1 + nu)), within the default but not a tighter tolerance
+      const eng::MaterialBase loose(200_GPa, 79_GPa, 0.3);
+      Assert::IsFalse(loose.consistent(0.01));
+      Assert::IsFalse(eng::MaterialBase(200_GPa, 100_GPa, 0.3).consistent());
+      Assert::IsFalse(eng::MaterialBase(200_GPa, 60_GPa, 0.3).consistent());
+
+      // the moduli must be positive and nu within (-1, 0.5)
+      Assert::IsFalse(eng::MaterialBase(0_GPa, 0.3).consistent());
+      Assert::IsFalse(eng::MaterialBase(-200_GPa, 0.3).consistent());
+      Assert::IsFalse(eng::MaterialBase(200_GPa, -80_GPa, 0.3).consistent());
+      Assert::IsFalse(eng::MaterialBase(200_GPa, 0.5).consistent());
+      Assert::IsFalse(eng::MaterialBase(200_GPa, -1.0).consistent());
+      Assert::IsFalse(eng::MaterialBase(200_GPa, 200_GPa, std::nan("")).consistent());
+    }
+  };
+  TEST_CLASS(TestMaterialRegistry) {
+    eng::Material steel{250_MPa, 400_MPa, 200_GPa, 79_GPa, 0.3};
+    eng::Material aluminum{270_MPa, 310_MPa, 69_GPa, 26_GPa, 0.33};
+  public:
+    TEST_METHOD(Interning) {
+      eng::MaterialRegistry registry;
+      const eng::MaterialHandle a = registry.intern(steel);
+      const eng::MaterialHandle b = registry.intern(aluminum);
+      // an equal material built separately shares the handle
+      const eng::MaterialHandle c = registry.intern(eng::Material(250_MPa, 400_MPa, 200_GPa,
+                                                                  79_GPa, 0.3));
+      Assert::AreEqual(a, c);
+      Assert::AreNotEqual(a, b);
+      Assert::AreEqual(size_t(2), registry.size());
+
+      // one property differing makes another material
+      Assert::AreEqual(eng::MaterialHandle(2),
+                       registry.intern(eng::Material(251_MPa, 400_MPa, 200_GPa, 79_GPa, 0.3)));
+
+      const eng::MaterialGrade* grade = eng::basic_materials::find("1018 CD");
+      const eng::MaterialHandle g = registry.intern(*grade);
+      Assert::AreEqual(g, registry.intern(grade->material()));
+      Assert::AreEqual(size_t(4), registry.size());
+
+      const eng::Material copy = registry[b];
+      Assert::AreEqual(270_MPa, copy.Sy());
+      Assert::AreEqual(26_GPa, copy.G());
+      Assert::AreEqual(1/69e9, registry.properties().inverse_E[b], 1e-24);
+      Assert::AreEqual(1/26e9, registry.properties().inverse_G[b], 1e-24);
+    }
+    TEST_METHOD(Contains) {
+      eng::MaterialRegistry registry;
+      registry.intern(steel);
+      registry.intern(aluminum);
+      const eng::MaterialPropertyArray& properties = registry.properties();
+      Assert::IsTrue(properties.contains({0, 1, 1}, 3));
+      Assert::IsFalse(properties.contains({0, 1}, 3));
+      Assert::IsFalse(properties.contains({0, 2, 1}, 3));
+    }
+    TEST_METHOD(BatchHookesLaw) {
+      eng::MaterialRegistry registry;
+      std::vector<eng::MaterialHandle> handles{registry.intern(steel), registry.intern(aluminum),
+                                               registry.intern(steel)};
+      eng::StressElement3Array stress;
+      stress.push_back(eng::StressElement3(100_MPa, -50_MPa, 20_MPa, 30_MPa, 10_MPa, -5_MPa));
+      stress.push_back(eng::StressElement3(80_MPa, 10_MPa, 0_MPa, 20_MPa, 0_MPa, 0_MPa));
+      stress.push_back(eng::StressElement3(-20_MPa, 0_MPa, 40_MPa, 0_MPa, 15_MPa, 0_MPa));
+
+      eng::StrainElement3Array strain;
+      Assert::IsTrue(eng::hookes_law(registry.properties(), handles, stress, strain));
+      Assert::AreEqual(size_t(3), strain.size());
+      for (std::size_t i = 0; i != 3; ++i) {
+        const eng::Material material = registry[handles[i]];
+        const eng::NormalStrain normal = eng::hookes_law(material, stress[i]);
+        const eng::ShearStrain shear = eng::hookes_law_shear(material, stress[i]);
+        Assert::AreEqual(normal.epsilon_x, strain.epsilon_x[i], 1e-15);
+        Assert::AreEqual(normal.epsilon_y, strain.epsilon_y[i], 1e-15);
+        Assert::AreEqual(normal.epsilon_z, strain.epsilon_z[i], 1e-15);
+        Assert::AreEqual(shear.gamma_xy.rad(), strain.gamma_xy[i], 1e-15);
+        Assert::AreEqual(shear.gamma_xz.rad(), strain.gamma_xz[i], 1e-15);
+      }
+
+      // every element needs a handle in the properties
+      handles.pop_back();
+      Assert::IsFalse(eng::hookes_law(registry.properties(), handles, stress, strain));
+      Assert::AreEqual(size_t(0), strain.size());
+      handles.push_back(7);
+      Assert::IsFalse(eng::hookes_law(registry.properties(), handles, stress, strain));
+    }
+    TEST_METHOD(BatchFactorOfSafety) {
+      eng::MaterialRegistry registry;
+      std::vector<eng::MaterialHandle> handles{registry.intern(steel), registry.intern(aluminum)};
+      eng::StressElement2Array planar;
+      planar.push_back(eng::StressElement2(100_MPa, -50_MPa, 40_MPa));
+      planar.push_back(eng::StressElement2(200_MPa));
+      std::vector<double> n;
+
+      // 270/200 for the aluminum is below 250/149.33 for the steel
+      Assert::AreEqual(1.35, eng::factor_of_safety_von_mises(planar, registry.properties(),
+                                                             handles, n), 1e-9);
+      Assert::AreEqual(eng::factor_of_safety_von_mises(planar[0], steel), n[0], 1e-9);
+
+      eng::StressElement3Array solid;
+      solid.push_back(eng::StressElement3(200_MPa));
+      solid.push_back(eng::StressElement3(0_MPa, 0_MPa, 0_MPa, 100_MPa));
+      Assert::AreEqual(1.25, eng::factor_of_safety_von_mises(solid, registry.properties(),
+                                                             handles, n), 1e-9);
+      Assert::AreEqual(270/173.20508, n[1], 1e-6);
+
+      handles.push_back(0);
+      Assert::IsTrue(std::isnan(eng::factor_of_safety_von_mises(planar, registry.properties(),
+                                                                handles, n)));
+      Assert::IsTrue(n.empty());
+      handles = {0, 2};
+      Assert::IsTrue(std::isnan(eng::factor_of_safety_von_mises(solid, registry.properties(),
+                                                                handles, n)));
+    }
+  };
+};  // namespace MaterialTests
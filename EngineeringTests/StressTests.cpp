@@ -0,0 +1,484 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "UnitHelperFunctions.h"
+#include "EngineeringLibrary/Engineering.h"
+
+#include <cmath>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace StressTests {
+  TEST_CLASS(TestPrincipalStress) {
+  public:
+    TEST_METHOD(Ordered) {
+      eng::PrincipalStress3 p = eng::principal_stress(eng::StressElement3(-20_MPa, 60_MPa, 10_MPa));
+
+      Assert::AreEqual(60_MPa, p.sigma_1);
+      Assert::AreEqual(10_MPa, p.sigma_2);
+      Assert::AreEqual(-20_MPa, p.sigma_3);
+    }
+    TEST_METHOD(RepeatedRoots) {
+      eng::PrincipalStress3 p = eng::principal_stress(eng::StressElement3(100_MPa, 50_MPa, 100_MPa));
+      Assert::AreEqual(100_MPa, p.sigma_1);
+      Assert::AreEqual(100_MPa, p.sigma_2);
+      Assert::AreEqual(50_MPa, p.sigma_3);
+
+      // equal shears on every face give 2t, -t, -t
+      p = eng::principal_stress(eng::StressElement3(0_MPa, 0_MPa, 0_MPa, 30_MPa, 30_MPa, 30_MPa));
+      Assert::AreEqual(60_MPa, p.sigma_1);
+      Assert::AreEqual(-30_MPa, p.sigma_2);
+      Assert::AreEqual(-30_MPa, p.sigma_3);
+    }
+    TEST_METHOD(Hydrostatic) {
+      eng::PrincipalStress3 p = eng::principal_stress(eng::StressElement3(-80_MPa, -80_MPa, -80_MPa));
+
+      Assert::AreEqual(-80_MPa, p.sigma_1);
+      Assert::AreEqual(-80_MPa, p.sigma_2);
+      Assert::AreEqual(-80_MPa, p.sigma_3);
+    }
+    TEST_METHOD(PureShear) {
+      eng::PrincipalStress3 p = eng::principal_stress(eng::StressElement3(0_MPa, 0_MPa, 0_MPa,
+                                                                           0_MPa, 0_MPa, 50_MPa));
+
+      Assert::AreEqual(50_MPa, p.sigma_1);
+      Assert::AreEqual(0.0, p.sigma_2.value(), 1e-6);
+      Assert::AreEqual(-50_MPa, p.sigma_3);
+    }
+    TEST_METHOD(Directions) {
+      eng::StressElement3 s(40_MPa, -25_MPa, 15_MPa, 30_MPa, -10_MPa, 20_MPa);
+      Eigen::Matrix3d directions;
+      eng::PrincipalStress3 eigen = eng::principal_stress(s, directions);
+      eng::PrincipalStress3 closed = eng::principal_stress(s);
+
+      Assert::AreEqual(eigen.sigma_1, closed.sigma_1);
+      Assert::AreEqual(eigen.sigma_2, closed.sigma_2);
+      Assert::AreEqual(eigen.sigma_3, closed.sigma_3);
+
+      // each direction is a unit vector the tensor only stretches
+      Eigen::Matrix3d tensor;
+      tensor << 40, 30, -10,
+                30, -25, 20,
+                -10, 20, 15;
+      const double values[3] = {closed.sigma_1.value()*1e-6, closed.sigma_2.value()*1e-6,
+                                closed.sigma_3.value()*1e-6};
+      for (int i = 0; i != 3; ++i) {
+        const Eigen::Vector3d n = directions.col(i);
+        Assert::AreEqual(1.0, n.norm(), 1e-12);
+        Assert::AreEqual(0.0, (tensor*n - values[i]*n).norm(), 1e-9);
+      }
+    }
+    TEST_METHOD(Batch) {
+      eng::StressElement3Array elements;
+      elements.push_back(eng::StressElement3(40_MPa, -25_MPa, 15_MPa, 30_MPa, -10_MPa, 20_MPa));
+      elements.push_back(eng::StressElement3(-80_MPa, -80_MPa, -80_MPa));
+      eng::PrincipalStress3Array principal;
+      eng::principal_stress(elements, principal);
+
+      Assert::AreEqual(size_t(2), principal.size());
+      for (std::size_t i = 0; i != elements.size(); ++i) {
+        const eng::PrincipalStress3 p = eng::principal_stress(elements[i]);
+        Assert::AreEqual(p.sigma_1, principal[i].sigma_1);
+        Assert::AreEqual(p.sigma_2, principal[i].sigma_2);
+        Assert::AreEqual(p.sigma_3, principal[i].sigma_3);
+      }
+    }
+  };
+  TEST_CLASS(TestStressTransformation) {
+    eng::StressElement2 planar{100_MPa, -50_MPa, 40_MPa};
+  public:
+    TEST_METHOD(Rotate) {
+      eng::StressElement2 r = eng::rotate(eng::StressElement2(100_MPa), 45_deg);
+      Assert::AreEqual(50_MPa, r.sigma_x);
+      Assert::AreEqual(50_MPa, r.sigma_y);
+      Assert::AreEqual(-50_MPa, r.tau_xy);
+
+      // a rotation about z matches the planar rotation
+      const double c = std::cos(0.3), s = std::sin(0.3);
+      Eigen::Matrix3d rotation;
+      rotation << c, s, 0,
+                  -s, c, 0,
+                  0, 0, 1;
+      eng::StressElement3 r3 = eng::rotate(eng::StressElement3(100_MPa, -50_MPa, 0_MPa, 40_MPa),
+                                           rotation);
+      eng::StressElement2 r2 = eng::rotate(planar, 0.3_rad);
+      Assert::AreEqual(r2.sigma_x, r3.sigma_x);
+      Assert::AreEqual(r2.sigma_y, r3.sigma_y);
+      Assert::AreEqual(r2.tau_xy, r3.tau_xy);
+      Assert::AreEqual(0.0, r3.tau_xz.value(), 1e-6);
+    }
+    TEST_METHOD(MohrsCircle) {
+      eng::MohrCircle circle = eng::mohr_circle(planar);
+      Assert::AreEqual(25_MPa, circle.center);
+      Assert::AreEqual(85_MPa, circle.radius);
+      Assert::AreEqual(100_MPa, circle.normal_stress(0_rad));
+      Assert::AreEqual(40_MPa, circle.shear_stress(0_rad));
+
+      // the circle agrees with a rotation of the element
+      eng::StressElement2 r = eng::rotate(planar, 0.7_rad);
+      Assert::AreEqual(r.sigma_x, circle.normal_stress(0.7_rad));
+      Assert::AreEqual(r.tau_xy, circle.shear_stress(0.7_rad));
+
+      auto circles = eng::mohr_circles(eng::PrincipalStress3(100_MPa, 20_MPa, -60_MPa));
+      Assert::AreEqual(80_MPa, circles[0].radius);
+      Assert::AreEqual(40_MPa, circles[1].radius);
+      Assert::AreEqual(40_MPa, circles[2].radius);
+      Assert::AreEqual(-20_MPa, circles[2].center);
+    }
+    TEST_METHOD(RotationTable) {
+      eng::RotationTable2 table(0_deg, 90_deg, 7);
+      eng::StressElement2Array rotated;
+      table.rotate(planar, rotated);
+
+      Assert::AreEqual(size_t(7), rotated.size());
+      for (std::size_t i = 0; i != table.size(); ++i) {
+        eng::StressElement2 r = eng::rotate(planar, table.angle(i));
+        Assert::AreEqual(r.sigma_x.value(), rotated.sigma_x[i], 1e-6);
+        Assert::AreEqual(r.sigma_y.value(), rotated.sigma_y[i], 1e-6);
+        Assert::AreEqual(r.tau_xy.value(), rotated.tau_xy[i], 1e-6);
+      }
+    }
+    TEST_METHOD(PlaneTable) {
+      // the pole, 8 normals on each of 3 cones and 4 on the equator
+      eng::PlaneTable3 table(4, 8);
+      Assert::AreEqual(size_t(1 + 3*8 + 4), table.size());
+      for (std::size_t i = 0; i != table.size(); ++i) {
+        for (std::size_t j = 0; j != i; ++j) {
+          Assert::IsTrue(std::abs(table.normal(i).dot(table.normal(j))) < 1 - 1e-9);
+        }
+      }
+      Assert::AreEqual(size_t(1 + 2*5 + 5), eng::PlaneTable3(3, 5).size());
+
+      // uniaxial tension has its largest shear on the planes at 45 degrees
+      std::vector<double> normal, shear;
+      eng::StressElement3 tension(100_MPa);
+      const std::size_t worst = table.plane_stress(tension, normal, shear);
+      Assert::AreEqual(50e6, shear[worst], 1e-6);
+      Assert::AreEqual(50e6, normal[worst], 1e-6);
+
+      eng::PlaneStress on = eng::plane_stress(tension, table.normal(worst));
+      Assert::AreEqual(50_MPa, on.normal);
+      Assert::AreEqual(50_MPa, on.shear);
+    }
+  };
+  TEST_CLASS(TestThickWalledCylinder) {
+    eng::ThickWalledCylinder cylinder{50_mm, 100_mm};
+  public:
+    TEST_METHOD(Lame) {
+      eng::CylinderStressField field;
+      cylinder.field(100_MPa, 0_MPa, 0_N, 3, field);
+
+      Assert::AreEqual(size_t(3), field.size());
+      Assert::AreEqual(0.075, field.radius[1], 1e-12);
+      // Pi(b^2 + a^2)/(b^2 - a^2) at the bore and 2Pi a^2/(b^2 - a^2) outside
+      Assert::AreEqual(-100e6, field.radial[0], 1e-3);
+      Assert::AreEqual(166666666.7, field.hoop[0], 1.0);
+      Assert::AreEqual(0.0, field.radial[2], 1e-3);
+      Assert::AreEqual(66666666.67, field.hoop[2], 1.0);
+      // the end caps carry Pi a^2/(b^2 - a^2)
+      Assert::AreEqual(33333333.33, field.axial[1], 1.0);
+      Assert::AreEqual(166.66667_MPa, field.principal_stress(0).sigma_1);
+      Assert::AreEqual(-100_MPa, field.principal_stress(0).sigma_3);
+
+      // an axial force adds F/(pi(b^2 - a^2)) and open ends carry nothing
+      cylinder.field(100_MPa, 0_MPa, 23561.945_N, 3, field, false);
+      Assert::AreEqual(1e6, field.axial[0], 1.0);
+    }
+    TEST_METHOD(Batch) {
+      eng::CylinderStressField batch, single;
+      Assert::IsTrue(cylinder.field({100_MPa, 0_MPa}, {0_MPa, 20_MPa}, 0_N, 4, batch));
+      Assert::AreEqual(size_t(8), batch.size());
+
+      cylinder.field(0_MPa, 20_MPa, 0_N, 4, single);
+      for (std::size_t j = 0; j != single.size(); ++j) {
+        Assert::AreEqual(single.radius[j], batch.radius[4 + j], 1e-12);
+        Assert::AreEqual(single.radial[j], batch.radial[4 + j], 1e-3);
+        Assert::AreEqual(single.hoop[j], batch.hoop[4 + j], 1e-3);
+        Assert::AreEqual(single.axial[j], batch.axial[4 + j], 1e-3);
+      }
+
+      // every internal pressure needs an external pressure
+      Assert::IsFalse(cylinder.field({100_MPa, 0_MPa}, {0_MPa}, 0_N, 4, batch));
+      Assert::AreEqual(size_t(0), batch.size());
+    }
+    TEST_METHOD(PressFit) {
+      eng::MaterialBase steel(200_GPa, 0.3);
+      eng::PressFit fit(0_mm, 25_mm, 50_mm, steel, steel);
+
+      // for one material and a solid shaft, pR/E*2ro^2/(ro^2 - R^2)
+      Assert::AreEqual(eng::press_fit_interference(0_mm, 25_mm, 50_mm, 50_MPa, steel, steel),
+                       fit.interference(50_MPa));
+      Assert::AreEqual(1.6666667e-5_m, fit.interference(50_MPa));
+      Assert::AreEqual(50_MPa, fit.contact_pressure(1.6666667e-5_m));
+
+      std::vector<double> pressure;
+      fit.contact_pressure({0_m, 1.6666667e-5_m}, pressure);
+      Assert::AreEqual(0.0, pressure[0]);
+      Assert::AreEqual(50e6, pressure[1], 10.0);
+
+      eng::CylinderStressField inner, outer;
+      fit.field(1.6666667e-5_m, 3, inner, outer);
+      Assert::AreEqual(-50e6, inner.radial[2], 10.0);
+      Assert::AreEqual(-50e6, inner.hoop[0], 10.0);
+      Assert::AreEqual(-50e6, outer.radial[0], 10.0);
+      Assert::AreEqual(0.0, outer.radial[2], 10.0);
+      Assert::AreEqual(0.0, outer.axial[1]);
+    }
+  };
+  TEST_CLASS(TestLinearElastic) {
+    eng::Material steel{250_MPa, 400_MPa, eng::MaterialBase(200_GPa, 0.3)};
+    eng::StressElement3 s{120_MPa, -40_MPa, 30_MPa, 25_MPa, -15_MPa, 10_MPa};
+  public:
+    TEST_METHOD(Inverse) {
+      const eng::LinearElastic materials[] = {
+        eng::LinearElastic(steel),
+        eng::LinearElastic(140_GPa, 10_GPa, 0.35, 0.02, 5_GPa),
+        eng::LinearElastic(140_GPa, 10_GPa, 8_GPa, 0.3, 0.28, 0.45, 5_GPa, 4.5_GPa, 3_GPa)
+      };
+      for (const auto& m : materials) {
+        Assert::IsTrue(m.admissible());
+        Assert::IsTrue((m.stiffness()*m.compliance()).isIdentity(1e-9));
+      }
+    }
+    TEST_METHOD(Isotropic) {
+      eng::LinearElastic elastic(steel);
+      // lambda + 2G on the diagonal and lambda off it
+      Assert::AreEqual(steel.lambda().value() + 2*steel.G().value(), elastic.stiffness()(0, 0),
+                       1e-3);
+      Assert::AreEqual(steel.lambda().value(), elastic.stiffness()(0, 1), 1e-3);
+      Assert::AreEqual(steel.G().value(), elastic.stiffness()(3, 3), 1e-3);
+
+      eng::NormalStrain normal;
+      eng::ShearStrain shear;
+      elastic.strain(s, normal, shear);
+      const eng::NormalStrain expected = eng::hookes_law(steel, s);
+      const eng::ShearStrain expected_shear = eng::hookes_law_shear(steel, s);
+      Assert::AreEqual(expected.epsilon_x, normal.epsilon_x, 1e-15);
+      Assert::AreEqual(expected.epsilon_y, normal.epsilon_y, 1e-15);
+      Assert::AreEqual(expected.epsilon_z, normal.epsilon_z, 1e-15);
+      Assert::AreEqual(expected_shear.gamma_xy, shear.gamma_xy);
+      Assert::AreEqual(expected_shear.gamma_xz, shear.gamma_xz);
+      Assert::AreEqual(expected_shear.gamma_yz, shear.gamma_yz);
+
+      const eng::StressElement3 back = elastic.stress(normal, shear);
+      Assert::AreEqual(s.sigma_x, back.sigma_x);
+      Assert::AreEqual(s.sigma_y, back.sigma_y);
+      Assert::AreEqual(s.sigma_z, back.sigma_z);
+      Assert::AreEqual(s.tau_xy, back.tau_xy);
+      Assert::AreEqual(s.tau_xz, back.tau_xz);
+      Assert::AreEqual(s.tau_yz, back.tau_yz);
+    }
+    TEST_METHOD(Inadmissible) {
+      Assert::IsFalse(eng::LinearElastic(eng::MaterialBase(200_GPa, 0.6)).admissible());
+    }
+    TEST_METHOD(Batch) {
+      eng::LinearElastic elastic(140_GPa, 10_GPa, 0.35, 0.02, 5_GPa);
+      eng::StressElement3Array stresses;
+      stresses.push_back(s);
+      stresses.push_back(eng::StressElement3(10_MPa, 0_MPa, -5_MPa));
+      eng::StrainElement3Array strains;
+      elastic.strain(stresses, strains);
+
+      Assert::AreEqual(size_t(2), strains.size());
+      for (std::size_t i = 0; i != stresses.size(); ++i) {
+        eng::NormalStrain normal;
+        eng::ShearStrain shear;
+        elastic.strain(stresses[i], normal, shear);
+        Assert::AreEqual(normal.epsilon_x, strains.epsilon_x[i], 1e-15);
+        Assert::AreEqual(normal.epsilon_z, strains.epsilon_z[i], 1e-15);
+        Assert::AreEqual(shear.gamma_xz.value(), strains.gamma_xz[i], 1e-15);
+      }
+
+      eng::StressElement3Array back;
+      elastic.stress(strains, back);
+      Assert::AreEqual(s.sigma_x.value(), back.sigma_x[0], 1e-3);
+      Assert::AreEqual(s.tau_yz.value(), back.tau_yz[0], 1e-3);
+    }
+  };
+  TEST_CLASS(TestRosette) {
+    eng::MaterialBase steel{200_GPa, 0.3};
+    // epsilon_x = 500, epsilon_y = -100 and gamma_xy = 400 microstrain,
+    //   with principal strains of 200 +- sqrt(300^2 + 200^2) microstrain
+    const double epsilon_1 = 560.55513e-6;
+    const double epsilon_2 = -160.55513e-6;
+  public:
+    TEST_METHOD(Rectangular) {
+      eng::Rosette rosette(eng::Rosette::Layout::RECTANGULAR);
+      eng::NormalStrain normal;
+      eng::ShearStrain shear;
+      rosette.strain(500e-6, 400e-6, -100e-6, normal, shear);
+      Assert::AreEqual(500e-6, normal.epsilon_x, 1e-12);
+      Assert::AreEqual(-100e-6, normal.epsilon_y, 1e-12);
+      Assert::AreEqual(400e-6, shear.gamma_xy.rad(), 1e-12);
+
+      const eng::NormalStrain principal = rosette.principal_strain(500e-6, 400e-6, -100e-6);
+      Assert::AreEqual(epsilon_1, principal.epsilon_x, 1e-11);
+      Assert::AreEqual(epsilon_2, principal.epsilon_y, 1e-11);
+
+      // E/(1 - nu^2) (epsilon_1 + nu epsilon_2) and E/(1 - nu^2) (epsilon_2 + nu epsilon_1)
+      const eng::PrincipalStress2 p = rosette.principal_stress(500e-6, 400e-6, -100e-6, steel);
+      Assert::AreEqual(112.61288_MPa, p.sigma_1);
+      Assert::AreEqual(1.6728375_MPa, p.sigma_2);
+    }
+    TEST_METHOD(Delta) {
+      // the gauges at 60 and 120 degrees read 125 - 75 +- 100 sqrt(3) microstrain
+      eng::Rosette rosette(eng::Rosette::Layout::DELTA);
+      eng::NormalStrain normal;
+      eng::ShearStrain shear;
+      rosette.strain(500e-6, 223.20508e-6, -123.20508e-6, normal, shear);
+      Assert::AreEqual(500e-6, normal.epsilon_x, 1e-10);
+      Assert::AreEqual(-100e-6, normal.epsilon_y, 1e-10);
+      Assert::AreEqual(400e-6, shear.gamma_xy.rad(), 1e-10);
+
+      const eng::NormalStrain principal = rosette.principal_strain(500e-6, 223.20508e-6,
+                                                                   -123.20508e-6);
+      Assert::AreEqual(epsilon_1, principal.epsilon_x, 1e-10);
+      Assert::AreEqual(epsilon_2, principal.epsilon_y, 1e-10);
+
+      // the same layout from its angles
+      const auto angles = eng::Rosette::gauges(0_deg, 60_deg, 120_deg);
+      Assert::IsTrue(angles.has_value());
+      angles->strain(500e-6, 223.20508e-6, -123.20508e-6, normal, shear);
+      Assert::AreEqual(400e-6, shear.gamma_xy.rad(), 1e-10);
+    }
+    TEST_METHOD(SameLine) {
+      // gauges 180 degrees apart read the same strain
+      Assert::IsFalse(eng::Rosette::gauges(0_deg, 90_deg, 180_deg).has_value());
+      Assert::IsFalse(eng::Rosette::gauges(30_deg, 30_deg, 90_deg).has_value());
+      Assert::IsFalse(eng::Rosette::gauges(45_deg, 0_deg, -135_deg).has_value());
+
+      // but any three lines make a rosette
+      const auto turned = eng::Rosette::gauges(180_deg, 225_deg, 270_deg);
+      Assert::IsTrue(turned.has_value());
+      eng::NormalStrain normal;
+      eng::ShearStrain shear;
+      turned->strain(500e-6, 400e-6, -100e-6, normal, shear);
+      Assert::AreEqual(500e-6, normal.epsilon_x, 1e-12);
+      Assert::AreEqual(-100e-6, normal.epsilon_y, 1e-12);
+      Assert::AreEqual(400e-6, shear.gamma_xy.rad(), 1e-12);
+    }
+    TEST_METHOD(Batch) {
+      eng::Rosette rosette(eng::Rosette::Layout::RECTANGULAR);
+      std::vector<double> a, b, c;
+      for (int i = 0; i != 1000; ++i) {
+        a.push_back(500e-6 - i*1e-6);
+        b.push_back(400e-6 + i*0.5e-6);
+        c.push_back(-100e-6 + i*2e-6);
+      }
+
+      eng::RosetteResults results;
+      rosette.reduce(a.data(), b.data(), c.data(), a.size(), steel, results);
+      Assert::AreEqual(size_t(1000), results.size());
+      Assert::AreEqual(epsilon_1, results.epsilon_1[0], 1e-11);
+      Assert::AreEqual(epsilon_2, results.epsilon_2[0], 1e-11);
+      // half of atan2(gamma_xy, epsilon_x - epsilon_y)
+      Assert::AreEqual(0.29400130, results.angle[0], 1e-8);
+      Assert::AreEqual(112.61288e6, results.sigma_1[0], 10.0);
+      Assert::AreEqual(1.6728375e6, results.sigma_2[0], 1.0);
+      for (std::size_t i = 0; i != a.size(); ++i) {
+        const eng::PrincipalStress2 p = rosette.principal_stress(a[i], b[i], c[i], steel);
+        Assert::AreEqual(p.sigma_1.value(), results.sigma_1[i], 1e-3);
+        Assert::AreEqual(p.sigma_2.value(), results.sigma_2[i], 1e-3);
+      }
+
+      // the threaded reduction gives the same results
+      eng::RosetteResults threaded;
+      rosette.reduce(a.data(), b.data(), c.data(), a.size(), steel, threaded, 4, 64);
+      Assert::IsTrue(threaded.sigma_1 == results.sigma_1);
+      Assert::IsTrue(threaded.angle == results.angle);
+    }
+  };
+  TEST_CLASS(TestHertzContact) {
+    eng::MaterialBase steel{200_GPa, 0.3};
+    // 1/E* = 2 (1 - 0.3^2)/200 GPa
+    eng::HertzContact contact{steel, steel};
+  public:
+    TEST_METHOD(Modulus) {
+      Assert::AreEqual(109.89011_GPa, contact.modulus());
+    }
+    TEST_METHOD(Spheres) {
+      // a^3 = 3FR/(4E*), p0 = 3F/(2 pi a^2) and delta = a^2/R, for the
+      //   effective radius R = 1/(1/R1 + 1/R2) = 5 mm
+      const auto geometry = eng::ContactGeometry::spheres(10_mm, 10_mm);
+      Assert::IsTrue(geometry.has_value());
+      Assert::AreEqual(1.0, geometry->ellipticity(), 1e-12);
+
+      const double E = contact.modulus().value();
+      const double a = std::cbrt(3*1000*0.005/(4*E));
+      const eng::ContactResult result = contact.point(*geometry, 1000_N);
+      Assert::AreEqual(a, result.a.value(), a*1e-9);
+      Assert::AreEqual(a, result.b.value(), a*1e-9);
+      Assert::AreEqual(3*1000/(2*eng::pi*a*a), result.max_pressure.value(), 1.0);
+      Assert::AreEqual(0.31*result.max_pressure.value(), result.max_shear.value(), 1.0);
+      Assert::AreEqual(a*a/0.005, result.approach->value(), 1e-15);
+    }
+    TEST_METHOD(Conformal) {
+      // a ball on a flat, and a ball in a larger spherical seat, have the
+      //   effective radii 10 mm and 1/(1/10 - 1/20) = 20 mm
+      const double E = contact.modulus().value();
+      const auto flat = eng::ContactGeometry::spheres(10_mm, 0_m);
+      const auto seat = eng::ContactGeometry::spheres(10_mm, -20_mm);
+      Assert::IsTrue(flat.has_value() && seat.has_value());
+
+      const double a_flat = std::cbrt(3*1000*0.01/(4*E));
+      const double a_seat = std::cbrt(3*1000*0.02/(4*E));
+      Assert::AreEqual(a_flat, contact.point(*flat, 1000_N).a.value(), a_flat*1e-9);
+      Assert::AreEqual(a_seat, contact.point(*seat, 1000_N).a.value(), a_seat*1e-9);
+
+      // two equal cylinders crossed at right angles touch like a sphere of
+      //   their radius on a flat
+      const auto crossed = eng::ContactGeometry::bodies(10_mm, 0_m, 10_mm, 0_m, 90_deg);
+      Assert::IsTrue(crossed.has_value());
+      Assert::AreEqual(a_flat, contact.point(*crossed, 1000_N).a.value(), a_flat*1e-9);
+    }
+    TEST_METHOD(Invalid) {
+      // nothing concentrates the contact of a flat on a flat
+      Assert::IsFalse(eng::ContactGeometry::spheres(0_m, 0_m).has_value());
+      Assert::IsFalse(eng::ContactGeometry::bodies(0_m, 0_m, 0_m, 0_m).has_value());
+      // a ball in a tighter seat
+      Assert::IsFalse(eng::ContactGeometry::spheres(10_mm, -5_mm).has_value());
+    }
+    TEST_METHOD(Elliptical) {
+      // a ball in a race groove, where the contact is longer across the race
+      const auto geometry = eng::ContactGeometry::bodies(6_mm, 6_mm, 30_mm, -6.3_mm);
+      Assert::IsTrue(geometry.has_value());
+      Assert::IsTrue(geometry->A() < geometry->B());
+      Assert::IsTrue(geometry->ellipticity() < 1);
+
+      const eng::ContactResult result = contact.point(*geometry, 500_N);
+      Assert::AreEqual(geometry->ellipticity(), result.b.value()/result.a.value(), 1e-12);
+      // the pressure is elliptical, so the force is 2/3 p0 pi a b
+      Assert::AreEqual(500.0, 2*eng::pi*result.max_pressure.value()*result.a.value()
+                              *result.b.value()/3, 1e-6);
+    }
+    TEST_METHOD(Line) {
+      // b = sqrt(4FR/(pi L E*)) and p0 = 2F/(pi b L), with R = 1/(1/10 + 1/20) mm
+      const double E = contact.modulus().value();
+      const double R = 1/(1/0.01 + 1/0.02);
+      const double b = std::sqrt(4*2000*R/(eng::pi*0.02*E));
+      const eng::ContactResult result = contact.line(10_mm, 20_mm, 20_mm, 2000_N);
+      Assert::AreEqual(b, result.b.value(), b*1e-9);
+      Assert::AreEqual(2*2000/(eng::pi*b*0.02), result.max_pressure.value(), 1.0);
+      Assert::AreEqual(10_mm, result.a);
+      Assert::IsFalse(result.approach.has_value());
+    }
+    TEST_METHOD(Batch) {
+      std::vector<eng::ContactGeometry> geometries{*eng::ContactGeometry::spheres(10_mm, 10_mm),
+        *eng::ContactGeometry::bodies(6_mm, 6_mm, 30_mm, -6.3_mm)};
+      std::vector<eng::Force> F{100_N, 1000_N, 5000_N};
+      eng::ContactArray results;
+      contact.point(geometries, F, results);
+      Assert::AreEqual(size_t(6), results.size());
+      for (std::size_t g = 0; g != geometries.size(); ++g) {
+        for (std::size_t i = 0; i != F.size(); ++i) {
+          const eng::ContactResult r = contact.point(geometries[g], F[i]);
+          const std::size_t j = g*F.size() + i;
+          Assert::AreEqual(r.a.value(), results.a[j], r.a.value()*1e-12);
+          Assert::AreEqual(r.max_pressure.value(), results.max_pressure[j], 1e-3);
+          Assert::AreEqual(r.approach->value(), results.approach[j], 1e-18);
+        }
+      }
+    }
+  };
+};  // namespace StressTests